@@ -0,0 +1,694 @@
+// HTSE benchmark suite
+//
+// Builds synthetic task graphs and measures the schedulers and the executor.
+// Every measurement is printed as one JSON object per line so results can be
+// collected and compared between releases.
+//
+// Build (Final mode only, from the repository root):
+//   g++ -std=c++17 -O2 -DEXEC_DELAY_MS=0 -Isrc bench/bench.cpp $(ls src/*.cpp | grep -v main.cpp) -o bench.exe -pthread
+// On Windows also link -lpsapi for the peak RSS figure.
+
+#ifdef D2_MODE
+#error "The benchmark needs the Final-mode scheduler hierarchy"
+#endif
+
+#include "config.h"
+#include "task.h"
+#include "task_store.h"
+#include "task_executor.h"
+#include "task_manager.h"
+#include "priority_scheduler.h"
+#include "deadline_scheduler.h"
+#include "hierarchical_scheduler.h"
+#include "critical_path_scheduler.h"
+#include "simulator.h"
+#include "concurrent_graph_builder.h"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <new>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <thread>
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+using namespace std;
+
+// ========== ALLOCATION COUNTING ==========
+// Every allocation carries a small header with its size so live and peak
+// heap bytes can be tracked exactly, independent of the platform allocator.
+
+static const size_t ALLOC_HEADER = 16;
+static atomic<unsigned long long> alloc_count(0);
+static atomic<long long> live_bytes(0);
+static atomic<long long> peak_bytes(0);
+
+void *operator new(size_t size)
+{
+    char *block = static_cast<char *>(malloc(size + ALLOC_HEADER));
+    if (block == nullptr)
+        throw bad_alloc();
+    memcpy(block, &size, sizeof(size));
+    alloc_count.fetch_add(1, memory_order_relaxed);
+    long long live = live_bytes.fetch_add(size, memory_order_relaxed) + size;
+    long long peak = peak_bytes.load(memory_order_relaxed);
+    while (live > peak && !peak_bytes.compare_exchange_weak(peak, live, memory_order_relaxed))
+    {
+    }
+    return block + ALLOC_HEADER;
+}
+
+void operator delete(void *pointer) noexcept
+{
+    if (pointer == nullptr)
+        return;
+    char *block = static_cast<char *>(pointer) - ALLOC_HEADER;
+    size_t size;
+    memcpy(&size, block, sizeof(size));
+    live_bytes.fetch_sub(size, memory_order_relaxed);
+    free(block);
+}
+
+void *operator new[](size_t size) { return operator new(size); }
+void operator delete[](void *pointer) noexcept { operator delete(pointer); }
+void operator delete(void *pointer, size_t) noexcept { operator delete(pointer); }
+void operator delete[](void *pointer, size_t) noexcept { operator delete(pointer); }
+
+// Counters for one measured section
+struct AllocationScope
+{
+    unsigned long long start_count;
+    long long start_live;
+
+    AllocationScope()
+    {
+        start_count = alloc_count.load();
+        start_live = live_bytes.load();
+        peak_bytes.store(start_live);
+    }
+    unsigned long long allocations() const { return alloc_count.load() - start_count; }
+    long long peakBytes() const { return peak_bytes.load() - start_live; }
+};
+
+static long peakRssKb()
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return static_cast<long>(counters.PeakWorkingSetSize / 1024);
+    return -1;
+#else
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+#endif
+}
+
+static double secondsSince(chrono::steady_clock::time_point start)
+{
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+// ========== GRAPH GENERATORS ==========
+
+// A graph built the same way TaskManager builds one: a shared column store
+// plus stable Task handles
+struct BenchGraph
+{
+    TaskStore store;
+    deque<Task> tasks;
+    vector<Task *> pointers;
+    size_t edges;
+
+    BenchGraph() : edges(0) {}
+
+    void addTasks(size_t count, mt19937 &rng)
+    {
+        uniform_int_distribution<int> priority(MIN_PRIORITY, MAX_PRIORITY), deadline(1, 365), time(1, 10);
+        store.reserve(count);
+        pointers.reserve(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            int row = store.addRow("T" + to_string(i + 1), priority(rng), deadline(rng), time(rng));
+            tasks.emplace_back(i + 1, &store, row);
+            pointers.push_back(&tasks.back());
+        }
+    }
+    void dependency(size_t task, size_t on)
+    {
+        tasks[task].addDependency(&tasks[on]);
+        edges++;
+    }
+    void subtask(size_t parent, size_t child)
+    {
+        tasks[parent].addSubtask(&tasks[child]);
+        edges++;
+    }
+};
+
+// Random DAG: each task depends on up to 4 random earlier tasks
+static void generateRandom(BenchGraph &graph, size_t count, mt19937 &rng)
+{
+    graph.addTasks(count, rng);
+    for (size_t i = 1; i < count; i++)
+    {
+        uniform_int_distribution<size_t> earlier(0, i - 1);
+        size_t degree = min<size_t>(i, 4);
+        for (size_t k = 0; k < degree; k++)
+            graph.dependency(i, earlier(rng));
+    }
+}
+
+// Deep chain: task i depends on task i - 1
+static void generateChain(BenchGraph &graph, size_t count, mt19937 &rng)
+{
+    graph.addTasks(count, rng);
+    for (size_t i = 1; i < count; i++)
+        graph.dependency(i, i - 1);
+}
+
+// Wide fan-out: every task depends on the first one
+static void generateFanout(BenchGraph &graph, size_t count, mt19937 &rng)
+{
+    graph.addTasks(count, rng);
+    for (size_t i = 1; i < count; i++)
+        graph.dependency(i, 0);
+}
+
+// Balanced subtask tree with 4 children per node
+static void generateTree(BenchGraph &graph, size_t count, mt19937 &rng)
+{
+    graph.addTasks(count, rng);
+    for (size_t i = 1; i < count; i++)
+        graph.subtask((i - 1) / 4, i);
+}
+
+// Wide and deep: sqrt(n) layers of sqrt(n) tasks, each depending on 2 random
+// tasks of the previous layer
+static void generateLayered(BenchGraph &graph, size_t count, mt19937 &rng)
+{
+    graph.addTasks(count, rng);
+    size_t width = max<size_t>(1, static_cast<size_t>(sqrt(static_cast<double>(count))));
+    uniform_int_distribution<size_t> column(0, width - 1);
+    for (size_t i = width; i < count; i++)
+    {
+        size_t layer_start = (i / width - 1) * width;
+        graph.dependency(i, layer_start + column(rng));
+        graph.dependency(i, layer_start + column(rng));
+    }
+}
+
+typedef void (*Generator)(BenchGraph &, size_t, mt19937 &);
+
+struct GeneratorEntry
+{
+    const char *name;
+    Generator generate;
+};
+
+static const GeneratorEntry GENERATORS[] = {
+    {"random", generateRandom},
+    {"chain", generateChain},
+    {"fanout", generateFanout},
+    {"tree", generateTree},
+    {"layered", generateLayered}};
+
+// ========== OUTPUT ==========
+
+// Builder for one JSON line
+class JsonLine
+{
+private:
+    ostringstream text;
+    bool first;
+
+    void key(const char *name)
+    {
+        text << (first ? "{" : ",") << "\"" << name << "\":";
+        first = false;
+    }
+
+public:
+    JsonLine() : first(true) {}
+    JsonLine &add(const char *name, const string &value)
+    {
+        key(name);
+        text << "\"" << value << "\"";
+        return *this;
+    }
+    JsonLine &add(const char *name, double value)
+    {
+        key(name);
+        text << value;
+        return *this;
+    }
+    JsonLine &add(const char *name, long long value)
+    {
+        key(name);
+        text << value;
+        return *this;
+    }
+    void print()
+    {
+        text << "}";
+        printf("%s\n", text.str().c_str());
+        fflush(stdout);
+    }
+};
+
+// ========== BENCHMARKS ==========
+
+struct Options
+{
+    vector<string> graphs;
+    vector<size_t> sizes;
+    vector<int> workers;
+    int repeat;
+    bool execute;
+    unsigned seed;
+};
+
+static void benchSchedulers(const BenchGraph &graph, const string &graph_name, size_t count, const Options &options)
+{
+    vector<unique_ptr<Scheduler>> schedulers;
+    schedulers.push_back(make_unique<PriorityScheduler>());
+    schedulers.push_back(make_unique<DeadlineScheduler>());
+    schedulers.push_back(make_unique<HierarchicalScheduler>());
+    schedulers.push_back(make_unique<CriticalPathScheduler>());
+
+    for (unique_ptr<Scheduler> &scheduler : schedulers)
+    {
+        vector<double> times;
+        unsigned long long allocations = 0;
+        long long peak = 0;
+        for (int r = 0; r < options.repeat; r++)
+        {
+            AllocationScope scope;
+            auto start = chrono::steady_clock::now();
+            vector<Task *> order = scheduler->schedule(graph.pointers);
+            times.push_back(secondsSince(start));
+            allocations = scope.allocations();
+            peak = scope.peakBytes();
+        }
+        sort(times.begin(), times.end());
+        JsonLine()
+            .add("bench", string("schedule"))
+            .add("graph", graph_name)
+            .add("tasks", (long long)count)
+            .add("edges", (long long)graph.edges)
+            .add("scheduler", scheduler->getName())
+            .add("repeat", (long long)options.repeat)
+            .add("min_seconds", times.front())
+            .add("median_seconds", times[times.size() / 2])
+            .add("ns_per_task", times.front() * 1e9 / count)
+            .add("allocs_per_task", (double)allocations / count)
+            .add("peak_heap_bytes", peak)
+            .print();
+    }
+}
+
+// Simulated makespan of the priority and critical-path orders against the
+// lower bound max(critical path, total work / workers)
+static void benchSimulation(const BenchGraph &graph, const string &graph_name, size_t count, const Options &options)
+{
+    CriticalPathScheduler critical_path;
+    PriorityScheduler priority;
+    vector<Task *> orders[2] = {priority.schedule(graph.pointers), critical_path.schedule(graph.pointers)};
+    string names[2] = {priority.getName(), critical_path.getName()};
+    long long total_work = 0;
+    for (const Task *task : graph.pointers)
+        total_work += task->getEstimatedTime();
+
+    for (int workers : options.workers)
+    {
+        long long bound = max(critical_path.getCriticalPathLength(), (total_work + workers - 1) / workers);
+        for (int s = 0; s < 2; s++)
+        {
+            Simulator simulator(workers);
+            SimulationResult result;
+            AllocationScope scope;
+            auto start = chrono::steady_clock::now();
+            simulator.run(orders[s], result);
+            double seconds = secondsSince(start);
+            JsonLine()
+                .add("bench", string("simulate"))
+                .add("graph", graph_name)
+                .add("tasks", (long long)count)
+                .add("edges", (long long)graph.edges)
+                .add("scheduler", names[s])
+                .add("workers", (long long)workers)
+                .add("seconds", seconds)
+                .add("tasks_per_second", count / seconds)
+                .add("makespan", result.makespan)
+                .add("makespan_lower_bound", bound)
+                .add("allocs_per_task", (double)scope.allocations() / count)
+                .add("peak_heap_bytes", scope.peakBytes())
+                .print();
+        }
+    }
+}
+
+// Concurrent ingest producer, first pass: create tasks [begin, end) and note
+// the ID each one was given (IDs interleave between producers)
+static void produceTasks(ConcurrentGraphBuilder *builder, const vector<TaskSpec> *specs, vector<int> *ids,
+                         size_t begin, size_t end)
+{
+    for (size_t i = begin; i < end; i++)
+    {
+        const TaskSpec &spec = (*specs)[i];
+        (*ids)[i] = builder->createTask(spec.name, spec.priority, spec.deadline, spec.time);
+    }
+}
+
+// Second pass: add every producers-th edge, translated to the builder's IDs
+static void produceEdges(ConcurrentGraphBuilder *builder, const vector<pair<int, int>> *dependencies,
+                         const vector<pair<int, int>> *subtasks, const vector<int> *ids, size_t first, size_t step)
+{
+    for (size_t i = first; i < dependencies->size(); i += step)
+        builder->addDependency((*ids)[(*dependencies)[i].first - 1], (*ids)[(*dependencies)[i].second - 1]);
+    for (size_t i = first; i < subtasks->size(); i += step)
+        builder->addSubtask((*ids)[(*subtasks)[i].first - 1], (*ids)[(*subtasks)[i].second - 1]);
+}
+
+// TaskManager ingest of the same graph through createTask/addDependency one call
+// at a time and through the bulk createTasks/addDependencies APIs
+static void benchIngest(const BenchGraph &graph, const string &graph_name, size_t count)
+{
+    vector<TaskSpec> specs(count);
+    vector<pair<int, int>> dependencies, subtasks;
+    for (size_t i = 0; i < count; i++)
+    {
+        const Task &task = graph.tasks[i];
+        specs[i].name = task.getName();
+        specs[i].priority = task.getPriority();
+        specs[i].deadline = task.getDeadline();
+        specs[i].time = task.getEstimatedTime();
+        for (const Task *dependency : task.getDependencies())
+            dependencies.push_back(make_pair(task.getId(), dependency->getId()));
+        for (const Task *subtask : task.getSubtasks())
+            subtasks.push_back(make_pair(task.getId(), subtask->getId()));
+    }
+
+    static const char *const MODES[] = {"per_call", "bulk", "concurrent"};
+    size_t producers = max(1u, thread::hardware_concurrency());
+    ofstream discard;
+    for (int mode = 0; mode < 3; mode++)
+    {
+        AllocationScope scope;
+        auto start = chrono::steady_clock::now();
+        {
+            TaskManager manager(discard);
+            if (mode == 2)
+            {
+                // Producers share one builder; the TaskManager sees a single commit
+                ConcurrentGraphBuilder builder(manager);
+                vector<int> ids(count);
+                vector<thread> threads;
+                for (size_t p = 0; p < producers; p++)
+                    threads.emplace_back(produceTasks, &builder, &specs, &ids, count * p / producers,
+                                         count * (p + 1) / producers);
+                for (thread &producer : threads)
+                    producer.join();
+                threads.clear();
+                for (size_t p = 0; p < producers; p++)
+                    threads.emplace_back(produceEdges, &builder, &dependencies, &subtasks, &ids, p, producers);
+                for (thread &producer : threads)
+                    producer.join();
+                string error;
+                builder.commit(error);
+            }
+            else
+            {
+                if (mode == 1)
+                {
+                    string error;
+                    manager.createTasks(specs);
+                    manager.addDependencies(dependencies, error);
+                }
+                else
+                {
+                    for (const TaskSpec &spec : specs)
+                        manager.createTask(spec.name, spec.priority, spec.deadline, spec.time);
+                    for (const pair<int, int> &edge : dependencies)
+                        manager.addDependency(edge.first, edge.second);
+                }
+                for (const pair<int, int> &edge : subtasks)
+                    manager.addSubtask(edge.first, edge.second);
+            }
+            double seconds = secondsSince(start);
+            JsonLine()
+                .add("bench", string("ingest"))
+                .add("graph", graph_name)
+                .add("tasks", (long long)count)
+                .add("edges", (long long)graph.edges)
+                .add("mode", string(MODES[mode]))
+                .add("producers", (long long)(mode == 2 ? producers : 1))
+                .add("seconds", seconds)
+                .add("edges_per_second", graph.edges / seconds)
+                .add("allocs_per_task", (double)scope.allocations() / count)
+                .add("peak_heap_bytes", scope.peakBytes())
+                .print();
+        }
+    }
+}
+
+static void benchExecution(const string &graph_name, size_t count, int workers, const Options &options)
+{
+    // Execution completes every task, so each run gets a fresh graph
+    mt19937 rng(options.seed);
+    BenchGraph graph;
+    const GeneratorEntry *entry = nullptr;
+    for (const GeneratorEntry &candidate : GENERATORS)
+        if (graph_name == candidate.name)
+            entry = &candidate;
+    entry->generate(graph, count, rng);
+
+    PriorityScheduler scheduler;
+    vector<Task *> order = scheduler.schedule(graph.pointers);
+
+    ofstream discard; // Never opened; quiet mode skips formatting the log entirely
+    TaskExecutor executor(discard);
+    executor.setQuiet(true);
+    executor.setDelayPerUnit(0);
+    executor.setWorkerCount(workers);
+
+    AllocationScope scope;
+    auto start = chrono::steady_clock::now();
+    executor.runTasks(order, scheduler.getName());
+    double seconds = secondsSince(start);
+
+    JsonLine()
+        .add("bench", string("execute"))
+        .add("graph", graph_name)
+        .add("tasks", (long long)count)
+        .add("edges", (long long)graph.edges)
+        .add("workers", (long long)workers)
+        .add("seconds", seconds)
+        .add("tasks_per_second", count / seconds)
+        .add("allocs_per_task", (double)scope.allocations() / count)
+        .add("peak_heap_bytes", scope.peakBytes())
+        .print();
+}
+
+// Online EDF producer: submit tasks [begin, end) and, after each one, move
+// the deadline of an earlier task of the same slice
+static void produceOnline(DeadlineScheduler *queue, const vector<Task *> *tasks, size_t begin, size_t end,
+                          unsigned seed)
+{
+    mt19937 rng(seed);
+    uniform_int_distribution<int> deadline(1, 365);
+    for (size_t i = begin; i < end; i++)
+    {
+        queue->submit((*tasks)[i]);
+        size_t earlier = begin + rng() % (i - begin + 1);
+        queue->updateDeadline((*tasks)[earlier], deadline(rng));
+    }
+}
+
+// TaskExecutor::runOnline draining a DeadlineScheduler while producer threads
+// keep submitting tasks and changing deadlines. The tasks are created up front
+// (see deadline_scheduler.h); the drain itself runs on this thread only.
+static void benchOnline(const string &graph_name, size_t count, const Options &options)
+{
+    mt19937 rng(options.seed);
+    BenchGraph graph;
+    const GeneratorEntry *entry = nullptr;
+    for (const GeneratorEntry &candidate : GENERATORS)
+        if (graph_name == candidate.name)
+            entry = &candidate;
+    entry->generate(graph, count, rng);
+
+    ofstream discard;
+    TaskExecutor executor(discard);
+    executor.setQuiet(true);
+    executor.setDelayPerUnit(0);
+    DeadlineScheduler queue;
+    size_t producers = max(2u, thread::hardware_concurrency() / 2);
+
+    AllocationScope scope;
+    auto start = chrono::steady_clock::now();
+    thread feeder([&]() {
+        vector<thread> threads;
+        for (size_t p = 0; p < producers; p++)
+            threads.emplace_back(produceOnline, &queue, &graph.pointers, count * p / producers,
+                                 count * (p + 1) / producers, options.seed + p);
+        for (thread &producer : threads)
+            producer.join();
+        queue.close();
+    });
+    executor.runOnline(queue);
+    feeder.join();
+    double seconds = secondsSince(start);
+
+    size_t completed = 0;
+    for (const Task *task : graph.pointers)
+        if (task->getStatus() == COMPLETED)
+            completed++;
+    JsonLine()
+        .add("bench", string("online"))
+        .add("graph", graph_name)
+        .add("tasks", (long long)count)
+        .add("edges", (long long)graph.edges)
+        .add("producers", (long long)producers)
+        .add("completed", (long long)completed)
+        .add("seconds", seconds)
+        .add("tasks_per_second", count / seconds)
+        .add("allocs_per_task", (double)scope.allocations() / count)
+        .add("peak_heap_bytes", scope.peakBytes())
+        .print();
+}
+
+static void runGraph(const GeneratorEntry &entry, size_t count, const Options &options)
+{
+    mt19937 rng(options.seed);
+    {
+        BenchGraph graph;
+        AllocationScope scope;
+        auto start = chrono::steady_clock::now();
+        entry.generate(graph, count, rng);
+        double seconds = secondsSince(start);
+        JsonLine()
+            .add("bench", string("build"))
+            .add("graph", string(entry.name))
+            .add("tasks", (long long)count)
+            .add("edges", (long long)graph.edges)
+            .add("seconds", seconds)
+            .add("allocs_per_task", (double)scope.allocations() / count)
+            .add("bytes_per_task", (double)scope.peakBytes() / count)
+            .add("peak_heap_bytes", scope.peakBytes())
+            .print();
+
+        benchSchedulers(graph, entry.name, count, options);
+        benchSimulation(graph, entry.name, count, options);
+        benchIngest(graph, entry.name, count);
+    }
+    if (options.execute)
+    {
+        for (int workers : options.workers)
+            benchExecution(entry.name, count, workers, options);
+        benchOnline(entry.name, count, options);
+    }
+}
+
+// ========== COMMAND LINE ==========
+
+static vector<string> splitList(const string &text)
+{
+    vector<string> items;
+    stringstream stream(text);
+    string item;
+    while (getline(stream, item, ','))
+        if (!item.empty())
+            items.push_back(item);
+    return items;
+}
+
+static void printUsage(const char *program)
+{
+    fprintf(stderr,
+            "Usage: %s [options]\n"
+            "  --graphs <list>   random,chain,fanout,tree,layered (default: all)\n"
+            "  --sizes <list>    Task counts, e.g. 1000,1e6 (default: 1000,10000,100000,1000000)\n"
+            "  --workers <list>  Executor thread counts (default: 1,<hardware threads>)\n"
+            "  --repeat <n>      Runs per scheduler measurement (default: 3)\n"
+            "  --seed <n>        Generator seed (default: 42)\n"
+            "  --no-execute      Only measure graph building and scheduling\n",
+            program);
+}
+
+int main(int argc, char *argv[])
+{
+    Options options;
+    options.graphs = {"random", "chain", "fanout", "tree", "layered"};
+    options.sizes = {1000, 10000, 100000, 1000000};
+    int hardware = thread::hardware_concurrency();
+    options.workers = {1};
+    if (hardware > 1)
+        options.workers.push_back(hardware);
+    options.repeat = 3;
+    options.execute = true;
+    options.seed = 42;
+
+    for (int i = 1; i < argc; i++)
+    {
+        bool has_value = (i + 1 < argc);
+        if (strcmp(argv[i], "--graphs") == 0 && has_value)
+            options.graphs = splitList(argv[++i]);
+        else if (strcmp(argv[i], "--sizes") == 0 && has_value)
+        {
+            options.sizes.clear();
+            for (const string &size : splitList(argv[++i]))
+                options.sizes.push_back(static_cast<size_t>(atof(size.c_str())));
+        }
+        else if (strcmp(argv[i], "--workers") == 0 && has_value)
+        {
+            options.workers.clear();
+            for (const string &workers : splitList(argv[++i]))
+                options.workers.push_back(max(1, atoi(workers.c_str())));
+        }
+        else if (strcmp(argv[i], "--repeat") == 0 && has_value)
+            options.repeat = max(1, atoi(argv[++i]));
+        else if (strcmp(argv[i], "--seed") == 0 && has_value)
+            options.seed = strtoul(argv[++i], nullptr, 10);
+        else if (strcmp(argv[i], "--no-execute") == 0)
+            options.execute = false;
+        else
+        {
+            printUsage(argv[0]);
+            return 2;
+        }
+    }
+
+    for (const string &name : options.graphs)
+    {
+        const GeneratorEntry *entry = nullptr;
+        for (const GeneratorEntry &candidate : GENERATORS)
+            if (name == candidate.name)
+                entry = &candidate;
+        if (entry == nullptr)
+        {
+            fprintf(stderr, "Unknown graph: %s\n", name.c_str());
+            return 2;
+        }
+        for (size_t count : options.sizes)
+            if (count > 0)
+                runGraph(*entry, count, options);
+    }
+
+    JsonLine().add("bench", string("process")).add("peak_rss_kb", (long long)peakRssKb()).print();
+    return 0;
+}
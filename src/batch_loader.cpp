@@ -0,0 +1,208 @@
+#include "batch_loader.h"
+#include <cstring>
+#include <vector>
+
+using namespace std;
+
+// Size of each block read from disk
+static const size_t READ_BLOCK = 1 << 20;
+
+// Split off the next comma-separated field, advancing pos past the comma
+static void nextField(const char *&pos, const char *end, const char *&field, size_t &length)
+{
+    field = pos;
+    const char *comma = static_cast<const char *>(memchr(pos, ',', end - pos));
+    const char *stop = comma ? comma : end;
+    length = stop - pos;
+    pos = comma ? comma + 1 : end;
+}
+
+// Parse a base-10 integer that must fill the whole field
+static bool parseInt(const char *field, size_t length, int &value)
+{
+    while (length > 0 && (*field == ' ' || *field == '\t'))
+    {
+        field++;
+        length--;
+    }
+    while (length > 0 && (field[length - 1] == ' ' || field[length - 1] == '\t'))
+        length--;
+
+    bool negative = (length > 0 && *field == '-');
+    size_t i = negative ? 1 : 0;
+    if (i == length)
+        return false;
+
+    long result = 0;
+    for (; i < length; i++)
+    {
+        if (field[i] < '0' || field[i] > '9' || result > 100000000L)
+            return false;
+        result = result * 10 + (field[i] - '0');
+    }
+    value = negative ? -result : result;
+    return true;
+}
+
+// Constructor
+BatchLoader::BatchLoader(TaskManager &mgr)
+    : manager(mgr), line_number(0), task_count(0), edge_count(0)
+{
+}
+
+bool BatchLoader::fail(const string &msg)
+{
+    error_message = "line " + to_string(line_number) + ": " + msg;
+    return false;
+}
+
+// Stream the file block by block, handing complete lines to parseLine
+bool BatchLoader::loadFile(const string &path)
+{
+    FILE *file = fopen(path.c_str(), "rb");
+    if (file == nullptr)
+        return fail("cannot open " + path);
+
+    vector<char> buffer(READ_BLOCK);
+    size_t carried = 0; // Bytes of an unfinished line kept from the previous block
+    bool ok = true;
+
+    while (ok)
+    {
+        if (carried == buffer.size())
+            buffer.resize(buffer.size() * 2); // Line longer than the buffer
+        size_t got = fread(buffer.data() + carried, 1, buffer.size() - carried, file);
+        size_t filled = carried + got;
+        bool at_eof = (got == 0);
+
+        const char *pos = buffer.data();
+        const char *end = buffer.data() + filled;
+        while (ok)
+        {
+            const char *newline = static_cast<const char *>(memchr(pos, '\n', end - pos));
+            if (newline == nullptr)
+            {
+                if (at_eof && pos < end)
+                {
+                    ok = parseLine(pos, end); // Last line without a newline
+                    pos = end;
+                }
+                break;
+            }
+            ok = parseLine(pos, newline);
+            pos = newline + 1;
+        }
+
+        carried = end - pos;
+        memmove(buffer.data(), pos, carried);
+        if (at_eof)
+            break;
+    }
+
+    fclose(file);
+    return ok && applyPending();
+}
+
+// Build the graph from the buffered records
+bool BatchLoader::applyPending()
+{
+    manager.createTasks(pending_tasks);
+    for (const pair<int, int> &edge : pending_subtasks)
+        manager.addSubtask(edge.first, edge.second);
+    string error;
+    bool ok = manager.addDependencies(pending_dependencies, error);
+    if (!ok)
+        error_message = error;
+    pending_tasks.clear();
+    pending_subtasks.clear();
+    pending_dependencies.clear();
+    return ok;
+}
+
+// Parse one record and apply it to the TaskManager
+bool BatchLoader::parseLine(const char *begin, const char *end)
+{
+    line_number++;
+    if (end > begin && end[-1] == '\r')
+        end--;
+    while (begin < end && (*begin == ' ' || *begin == '\t'))
+        begin++;
+    if (begin == end || *begin == '#')
+        return true;
+
+    const char *pos = begin, *field;
+    size_t length;
+    nextField(pos, end, field, length);
+
+    if (length == 4 && memcmp(field, "task", 4) == 0)
+    {
+        const char *name;
+        size_t name_length;
+        nextField(pos, end, name, name_length);
+
+        int values[3];
+        for (int i = 0; i < 3; i++)
+        {
+            nextField(pos, end, field, length);
+            if (!parseInt(field, length, values[i]))
+                return fail("expected task,<name>,<priority>,<deadline>,<time>");
+        }
+        if (field + length < end) // A comma follows the last field
+            return fail("unexpected fields after <time>");
+        if (values[0] < MIN_PRIORITY || values[0] > MAX_PRIORITY)
+            return fail("priority out of range");
+        if (values[1] < 0 || values[1] > MAX_DEADLINE)
+            return fail("deadline out of range");
+        if (values[2] < MIN_TIME || values[2] > MAX_TIME)
+            return fail("time out of range");
+
+        pending_tasks.push_back(TaskSpec());
+        TaskSpec &spec = pending_tasks.back();
+        spec.name.assign(name, name_length);
+        spec.priority = values[0];
+        spec.deadline = values[1];
+        spec.time = values[2];
+        task_count++;
+        return true;
+    }
+
+    bool is_subtask = (length == 7 && memcmp(field, "subtask", 7) == 0);
+    bool is_dependency = (length == 3 && memcmp(field, "dep", 3) == 0);
+    if (!is_subtask && !is_dependency)
+        return fail("unknown record type");
+
+    int first, second;
+    nextField(pos, end, field, length);
+    bool ok = parseInt(field, length, first);
+    nextField(pos, end, field, length);
+    if (!ok || !parseInt(field, length, second))
+        return fail("expected two task IDs");
+    if (field + length < end)
+        return fail("unexpected fields after the task IDs");
+    if (first < 1 || second < 1 || first > task_count || second > task_count)
+        return fail("unknown task ID");
+    if (is_subtask && first == second)
+        return fail("a task cannot be its own subtask");
+
+    if (is_subtask)
+        pending_subtasks.push_back(make_pair(first, second));
+    else
+        pending_dependencies.push_back(make_pair(first, second));
+    edge_count++;
+    return true;
+}
+
+const string &BatchLoader::getError() const
+{
+    return error_message;
+}
+
+long BatchLoader::getTaskCount() const
+{
+    return task_count;
+}
+
+long BatchLoader::getEdgeCount() const
+{
+    return edge_count;
+}
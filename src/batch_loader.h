@@ -0,0 +1,52 @@
+#ifndef BATCH_LOADER_H
+#define BATCH_LOADER_H
+
+#include <string>
+#include <cstdio>
+#include <vector>
+#include "task_manager.h"
+
+using namespace std;
+
+// OOP Concept: Abstraction - Builds a task graph from a file without the menu
+//
+// File format (CSV, one record per line, '#' starts a comment line):
+//   task,<name>,<priority>,<deadline>,<time>   IDs are assigned 1, 2, 3, ... in file order
+//   subtask,<parent_id>,<child_id>
+//   dep,<task_id>,<dependency_id>              task_id runs after dependency_id
+// Values follow the menu's bounds (priority 1-10, deadline 0-9999, time 1-9999)
+// and a task cannot be its own subtask; extra fields are an error.
+//
+// The file is read in large blocks and parsed in place. Records are buffered
+// and handed to TaskManager's bulk APIs once the whole file has been parsed,
+// so the graph is sized, deduplicated and cycle-checked in one pass.
+
+class BatchLoader
+{
+private:
+    TaskManager &manager;
+    string error_message;
+    long line_number;
+    long task_count;
+    long edge_count;
+
+    vector<TaskSpec> pending_tasks;
+    vector<pair<int, int>> pending_subtasks;
+    vector<pair<int, int>> pending_dependencies;
+
+    bool parseLine(const char *begin, const char *end);
+    bool applyPending();
+    bool fail(const string &msg);
+
+public:
+    explicit BatchLoader(TaskManager &mgr);
+
+    // Returns false on the first malformed line (see getError)
+    bool loadFile(const string &path);
+
+    const string &getError() const;
+    long getTaskCount() const;
+    long getEdgeCount() const;
+};
+
+#endif // BATCH_LOADER_H
@@ -0,0 +1,137 @@
+#include "concurrent_graph_builder.h"
+#include <algorithm>
+
+using namespace std;
+
+// Shards are handed to threads round-robin the first time they add an edge,
+// so up to SHARD_COUNT producer threads never share a shard
+static atomic<int> next_shard(0);
+
+// Constructor
+ConcurrentGraphBuilder::ConcurrentGraphBuilder(TaskManager &mgr)
+    : manager(mgr), first_id(mgr.getTaskCount() + 1), next_id(first_id),
+      chunks(new atomic<Chunk *>[MAX_CHUNKS])
+{
+    for (int i = 0; i < MAX_CHUNKS; i++)
+        chunks[i].store(nullptr, memory_order_relaxed);
+}
+
+// Destructor - pending work that was never committed is discarded
+ConcurrentGraphBuilder::~ConcurrentGraphBuilder()
+{
+    clear();
+}
+
+// The first thread to reach an empty chunk slot installs a chunk; a thread
+// that loses the race frees its own and uses the winner's
+ConcurrentGraphBuilder::Chunk *ConcurrentGraphBuilder::chunkFor(int index)
+{
+    Chunk *chunk = chunks[index].load(memory_order_acquire);
+    if (chunk)
+        return chunk;
+    Chunk *created = new Chunk();
+    if (chunks[index].compare_exchange_strong(chunk, created, memory_order_acq_rel, memory_order_acquire))
+        return created;
+    delete created;
+    return chunk;
+}
+
+ConcurrentGraphBuilder::Shard &ConcurrentGraphBuilder::localShard()
+{
+    static thread_local int index = next_shard.fetch_add(1, memory_order_relaxed) % SHARD_COUNT;
+    return shards[index];
+}
+
+bool ConcurrentGraphBuilder::isKnownId(int id) const
+{
+    return id >= 1 && id < first_id + getPendingTaskCount();
+}
+
+void ConcurrentGraphBuilder::clear()
+{
+    for (int i = 0; i < MAX_CHUNKS; i++)
+    {
+        delete chunks[i].load(memory_order_relaxed);
+        chunks[i].store(nullptr, memory_order_relaxed);
+    }
+    for (Shard &shard : shards)
+    {
+        vector<pair<int, int>>().swap(shard.subtasks);
+        vector<pair<int, int>>().swap(shard.dependencies);
+    }
+}
+
+int ConcurrentGraphBuilder::createTask(const string &name, int priority, int deadline, int time)
+{
+    int id = next_id.fetch_add(1, memory_order_relaxed);
+    int index = id - first_id;
+    if (index >= MAX_CHUNKS * CHUNK_SIZE)
+        return 0;
+    TaskSpec &spec = chunkFor(index >> CHUNK_BITS)->specs[index & (CHUNK_SIZE - 1)];
+    spec.name = name;
+    spec.priority = priority;
+    spec.deadline = deadline;
+    spec.time = time;
+    return id;
+}
+
+bool ConcurrentGraphBuilder::addSubtask(int parent_id, int subtask_id)
+{
+    if (!isKnownId(parent_id) || !isKnownId(subtask_id))
+        return false;
+    Shard &shard = localShard();
+    lock_guard<mutex> guard(shard.lock);
+    shard.subtasks.push_back(make_pair(parent_id, subtask_id));
+    return true;
+}
+
+bool ConcurrentGraphBuilder::addDependency(int task_id, int dependency_id)
+{
+    if (!isKnownId(task_id) || !isKnownId(dependency_id))
+        return false;
+    Shard &shard = localShard();
+    lock_guard<mutex> guard(shard.lock);
+    shard.dependencies.push_back(make_pair(task_id, dependency_id));
+    return true;
+}
+
+int ConcurrentGraphBuilder::getPendingTaskCount() const
+{
+    return min(next_id.load(memory_order_acquire) - first_id, MAX_CHUNKS * CHUNK_SIZE);
+}
+
+bool ConcurrentGraphBuilder::commit(string &error, size_t *dependencies_added)
+{
+    if (dependencies_added)
+        *dependencies_added = 0;
+    if (manager.getTaskCount() != first_id - 1)
+    {
+        error = "the task graph was changed outside the builder (expected " + to_string(first_id - 1) +
+                " tasks, found " + to_string(manager.getTaskCount()) + ")";
+        return false;
+    }
+
+    int count = getPendingTaskCount();
+    vector<TaskSpec> specs(count);
+    for (int i = 0; i < count; i++)
+        specs[i] = move(chunks[i >> CHUNK_BITS].load(memory_order_relaxed)->specs[i & (CHUNK_SIZE - 1)]);
+    manager.createTasks(specs);
+
+    size_t dependency_count = 0;
+    for (const Shard &shard : shards)
+        dependency_count += shard.dependencies.size();
+    vector<pair<int, int>> dependencies;
+    dependencies.reserve(dependency_count);
+    for (const Shard &shard : shards)
+    {
+        for (const pair<int, int> &edge : shard.subtasks)
+            manager.addSubtask(edge.first, edge.second);
+        dependencies.insert(dependencies.end(), shard.dependencies.begin(), shard.dependencies.end());
+    }
+    bool ok = manager.addDependencies(dependencies, error, dependencies_added);
+
+    clear();
+    first_id = manager.getTaskCount() + 1;
+    next_id.store(first_id, memory_order_release);
+    return ok;
+}
@@ -0,0 +1,80 @@
+#ifndef CONCURRENT_GRAPH_BUILDER_H
+#define CONCURRENT_GRAPH_BUILDER_H
+
+#include <string>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include "task_manager.h"
+
+using namespace std;
+
+// OOP Concept: Abstraction - Multi-producer front end for building a graph
+// Any number of threads may call createTask, addSubtask and addDependency at
+// the same time. IDs come from an atomic counter and are final: they are the
+// IDs the tasks get in the TaskManager. Task properties go into lock-free
+// chunked storage indexed by ID, and edges into one of SHARD_COUNT shards
+// picked per thread, so producers on different cores do not contend.
+//
+// commit() hands everything to the TaskManager's bulk APIs in one pass
+// (sizing, deduplication and the cycle check happen there) and must only be
+// called once every producer thread has finished. The TaskManager must not be
+// changed in any other way between creating the builder and committing.
+// Subtasks added to one parent from different threads keep the order of each
+// thread, but their order across threads is unspecified.
+
+class ConcurrentGraphBuilder
+{
+private:
+    static const int CHUNK_BITS = 12; // 4096 tasks per chunk
+    static const int CHUNK_SIZE = 1 << CHUNK_BITS;
+    static const int MAX_CHUNKS = 1 << 15;
+    static const int SHARD_COUNT = 64;
+
+    struct Chunk
+    {
+        TaskSpec specs[CHUNK_SIZE];
+    };
+
+    struct alignas(64) Shard
+    {
+        mutex lock;
+        vector<pair<int, int>> subtasks;
+        vector<pair<int, int>> dependencies;
+    };
+
+    TaskManager &manager;
+    int first_id;                         // First ID handed out by this builder
+    alignas(64) atomic<int> next_id;
+    unique_ptr<atomic<Chunk *>[]> chunks; // Allocated on first use, MAX_CHUNKS slots
+    Shard shards[SHARD_COUNT];
+
+    Chunk *chunkFor(int index);
+    Shard &localShard();
+    bool isKnownId(int id) const;
+    void clear();
+
+public:
+    explicit ConcurrentGraphBuilder(TaskManager &mgr);
+    ~ConcurrentGraphBuilder();
+    ConcurrentGraphBuilder(const ConcurrentGraphBuilder &) = delete;
+    ConcurrentGraphBuilder &operator=(const ConcurrentGraphBuilder &) = delete;
+
+    // Thread-safe. Returns the new task's ID, 0 when the builder is full
+    int createTask(const string &name, int priority, int deadline, int time);
+    // Thread-safe. False if either ID is neither in the TaskManager nor
+    // created by this builder; cycles are only detected by commit()
+    bool addSubtask(int parent_id, int subtask_id);
+    bool addDependency(int task_id, int dependency_id);
+
+    // Number of tasks created since the last commit
+    int getPendingTaskCount() const;
+
+    // Apply every pending task and edge to the TaskManager; false with a
+    // message if the TaskManager was changed behind the builder's back.
+    // Afterwards the builder continues with the next free ID.
+    bool commit(string &error, size_t *dependencies_added = nullptr);
+};
+
+#endif // CONCURRENT_GRAPH_BUILDER_H
@@ -41,6 +41,15 @@
 #define EXEC_DELAY_MS 500
 #endif
 
+// ===== TASK CONFIGURATION =====
+// Valid priority range (10 is highest); schedulers rely on this bound
+#define MIN_PRIORITY 1
+#define MAX_PRIORITY 10
+// Deadline (days) and execution time (units) accepted by the menu and batch files
+#define MAX_DEADLINE 9999
+#define MIN_TIME 1
+#define MAX_TIME 9999
+
 // ===== COLOR DEFINITIONS =====
 // ANSI escape codes for colored terminal output
 #if ENABLE_COLOR
@@ -0,0 +1,133 @@
+#include "critical_path_scheduler.h"
+#include "cycle_finder.h"
+#include <algorithm>
+
+using namespace std;
+
+// Orders positions by bottom-level (highest first), then by topological rank
+// so tasks with zero estimated time still come before their successors
+struct BottomLevelCompare
+{
+    const vector<long long> &level;
+    const vector<int> &topo_rank;
+
+    bool operator()(int a, int b) const
+    {
+        if (level[a] != level[b])
+            return level[a] > level[b];
+        return topo_rank[a] < topo_rank[b];
+    }
+};
+
+CriticalPathScheduler::CriticalPathScheduler() : critical_path_length(0)
+{
+}
+
+// Edges run from a task to everything that waits on it: dependency -> dependent
+// and subtask -> parent, with the same subtask rule as TaskExecutor and
+// Simulator (CycleFinder::findSubtaskGates). Only edges between scheduled tasks
+// are considered.
+vector<Task *> CriticalPathScheduler::schedule(const vector<Task *> &tasks)
+{
+    size_t count = tasks.size();
+    int max_id = 0;
+    for (Task *task : tasks)
+        max_id = max(max_id, task->getId());
+    vector<int> position_of(max_id + 1, -1);
+    for (size_t i = 0; i < count; i++)
+        position_of[tasks[i]->getId()] = i;
+
+    // Predecessor lists in CSR form (who must finish before each task)
+    vector<int> pred_offsets(count + 1, 0), successor_count(count, 0);
+    for (size_t i = 0; i < count; i++)
+    {
+        for (Task *dep : tasks[i]->getDependencies())
+        {
+            int id = dep->getId();
+            if (id <= max_id && position_of[id] >= 0)
+            {
+                pred_offsets[i + 1]++;
+                successor_count[position_of[id]]++;
+            }
+        }
+    }
+    vector<pair<int, int>> gates = CycleFinder::findSubtaskGates(tasks);
+    for (const pair<int, int> &gate : gates)
+    {
+        pred_offsets[gate.second + 1]++;
+        successor_count[gate.first]++;
+    }
+    for (size_t i = 0; i < count; i++)
+        pred_offsets[i + 1] += pred_offsets[i];
+    vector<int> preds(pred_offsets[count]);
+    vector<int> fill(pred_offsets.begin(), pred_offsets.end() - 1);
+    for (size_t i = 0; i < count; i++)
+    {
+        for (Task *dep : tasks[i]->getDependencies())
+        {
+            int id = dep->getId();
+            if (id <= max_id && position_of[id] >= 0)
+                preds[fill[i]++] = position_of[id];
+        }
+    }
+    for (const pair<int, int> &gate : gates)
+        preds[fill[gate.second]++] = gate.first;
+
+    // One reverse-topological pass: start from tasks nothing waits on and walk
+    // back along predecessor edges, finalizing a task once all its successors are done
+    vector<long long> level(count, 0), best_successor(count, 0);
+    vector<int> topo_rank(count, -1);
+    vector<int> stack;
+    for (size_t i = 0; i < count; i++)
+        if (successor_count[i] == 0)
+            stack.push_back(i);
+    int next_rank = count;
+    critical_path_length = 0;
+    while (!stack.empty())
+    {
+        int node = stack.back();
+        stack.pop_back();
+        level[node] = tasks[node]->getEstimatedTime() + best_successor[node];
+        topo_rank[node] = --next_rank;
+        critical_path_length = max(critical_path_length, level[node]);
+        for (int e = pred_offsets[node]; e < pred_offsets[node + 1]; e++)
+        {
+            int pred = preds[e];
+            best_successor[pred] = max(best_successor[pred], level[node]);
+            if (--successor_count[pred] == 0)
+                stack.push_back(pred);
+        }
+    }
+
+    // Tasks on or behind a cycle are never finalized; they go last in input order
+    for (size_t i = 0; i < count; i++)
+    {
+        if (topo_rank[i] < 0)
+        {
+            level[i] = -1;
+            topo_rank[i] = i;
+        }
+    }
+
+    vector<int> order(count);
+    for (size_t i = 0; i < count; i++)
+        order[i] = i;
+    BottomLevelCompare compare = {level, topo_rank};
+    sort(order.begin(), order.end(), compare);
+
+    vector<Task *> scheduled;
+    scheduled.reserve(count);
+    for (int position : order)
+        scheduled.push_back(tasks[position]);
+    return scheduled;
+}
+
+string CriticalPathScheduler::getName() const
+{
+    return "CriticalPathScheduler";
+}
+
+long long CriticalPathScheduler::getCriticalPathLength() const
+{
+    return critical_path_length;
+}
@@ -0,0 +1,34 @@
+#ifndef CRITICAL_PATH_SCHEDULER_H
+#define CRITICAL_PATH_SCHEDULER_H
+
+#include "scheduler.h"
+
+using namespace std;
+
+// OOP Concept: Inheritance - CriticalPathScheduler inherits from Scheduler
+// OOP Concept: Polymorphism - Implements abstract schedule() method
+// Highest-level-first (HLFET) list scheduling: every task gets a bottom-level,
+// the longest chain of estimated times from the task to the end of the graph,
+// and tasks are ordered by it. A task always precedes what waits on it
+// (its dependents, and the parent of a subtask unless the subtask depends on
+// that parent), so whenever a worker is free
+// it picks the ready task on the longest remaining path.
+
+class CriticalPathScheduler : public Scheduler
+{
+private:
+    long long critical_path_length; // Largest bottom-level of the last schedule
+
+public:
+    CriticalPathScheduler();
+
+    // OOP Concept: Polymorphism - Override pure virtual function
+    vector<Task *> schedule(const vector<Task *> &tasks) override;
+
+    string getName() const override;
+
+    // Lower bound on the makespan of the last scheduled graph for any worker count
+    long long getCriticalPathLength() const;
+};
+
+#endif // CRITICAL_PATH_SCHEDULER_H
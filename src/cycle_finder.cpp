@@ -0,0 +1,178 @@
+#include "cycle_finder.h"
+#include <algorithm>
+
+using namespace std;
+
+// Orders cycles by their first (smallest) member
+struct FirstMemberLess
+{
+    bool operator()(const vector<int> &a, const vector<int> &b) const
+    {
+        return a.front() < b.front();
+    }
+};
+
+vector<int> CycleFinder::findComponents(const vector<int> &offsets, const vector<int> &targets)
+{
+    int count = offsets.size() - 1;
+    const int UNVISITED = -1;
+    vector<int> index(count, UNVISITED), low_link(count, 0), next_edge(count, 0), component(count, -1);
+    vector<char> on_stack(count, 0);
+    vector<int> component_stack, call_stack;
+    int next_index = 0, next_component = 0;
+
+    for (int start = 0; start < count; start++)
+    {
+        if (index[start] != UNVISITED)
+            continue;
+        call_stack.push_back(start);
+        while (!call_stack.empty())
+        {
+            int node = call_stack.back();
+            if (index[node] == UNVISITED)
+            {
+                // First visit
+                index[node] = low_link[node] = next_index++;
+                next_edge[node] = offsets[node];
+                component_stack.push_back(node);
+                on_stack[node] = 1;
+            }
+
+            if (next_edge[node] < offsets[node + 1])
+            {
+                int target = targets[next_edge[node]++];
+                if (index[target] == UNVISITED)
+                    call_stack.push_back(target);
+                else if (on_stack[target])
+                    low_link[node] = min(low_link[node], index[target]);
+                continue;
+            }
+
+            // All edges done: close a component if node is its root, then return to the caller
+            call_stack.pop_back();
+            if (!call_stack.empty())
+            {
+                int parent = call_stack.back();
+                low_link[parent] = min(low_link[parent], low_link[node]);
+            }
+            if (low_link[node] != index[node])
+                continue;
+
+            int member;
+            do
+            {
+                member = component_stack.back();
+                component_stack.pop_back();
+                on_stack[member] = 0;
+                component[member] = next_component;
+            } while (member != node);
+            next_component++;
+        }
+    }
+    return component;
+}
+
+vector<vector<int>> CycleFinder::findCycles(const vector<Task *> &tasks)
+{
+    int count = tasks.size();
+    int max_id = 0;
+    for (Task *task : tasks)
+        max_id = max(max_id, task->getId());
+    vector<int> position_of(max_id + 1, -1);
+    for (int i = 0; i < count; i++)
+        position_of[tasks[i]->getId()] = i;
+
+    // Dependency edges by position (CSR)
+    vector<int> offsets(count + 1, 0), targets;
+    vector<char> self_loop(count, 0);
+    for (int i = 0; i < count; i++)
+    {
+        for (Task *dep : tasks[i]->getDependencies())
+        {
+            int id = dep->getId();
+            if (id > max_id || position_of[id] < 0)
+                continue;
+            targets.push_back(position_of[id]);
+            if (position_of[id] == i)
+                self_loop[i] = 1;
+        }
+        offsets[i + 1] = targets.size();
+    }
+
+    // Group the members of every component; a cycle is a component with more
+    // than one task or a task that depends on itself
+    vector<int> component = findComponents(offsets, targets);
+    int component_count = 0;
+    for (int i = 0; i < count; i++)
+        component_count = max(component_count, component[i] + 1);
+    vector<vector<int>> members(component_count);
+    for (int i = 0; i < count; i++)
+        members[component[i]].push_back(i);
+
+    vector<vector<int>> cycles;
+    for (const vector<int> &group : members)
+    {
+        if (group.size() < 2 && !self_loop[group.front()])
+            continue;
+        vector<int> ids;
+        for (int position : group)
+            ids.push_back(tasks[position]->getId());
+        sort(ids.begin(), ids.end());
+        cycles.push_back(ids);
+    }
+
+    sort(cycles.begin(), cycles.end(), FirstMemberLess());
+    return cycles;
+}
+
+vector<pair<int, int>> CycleFinder::findSubtaskGates(const vector<Task *> &tasks)
+{
+    int count = tasks.size();
+    int max_id = 0;
+    for (Task *task : tasks)
+        max_id = max(max_id, task->getId());
+    vector<int> position_of(max_id + 1, -1);
+    for (int i = 0; i < count; i++)
+    {
+        if (tasks[i]->getStatus() != COMPLETED)
+            position_of[tasks[i]->getId()] = i;
+    }
+
+    // Wait-for edges by position (CSR): dependencies and subtasks of pending tasks
+    vector<int> offsets(count + 1, 0), targets;
+    for (int i = 0; i < count; i++)
+    {
+        if (position_of[tasks[i]->getId()] == i)
+        {
+            for (Task *dep : tasks[i]->getDependencies())
+            {
+                int id = dep->getId();
+                if (id <= max_id && position_of[id] >= 0)
+                    targets.push_back(position_of[id]);
+            }
+            for (Task *subtask : tasks[i]->getSubtasks())
+            {
+                int id = subtask->getId();
+                if (id <= max_id && position_of[id] >= 0)
+                    targets.push_back(position_of[id]);
+            }
+        }
+        offsets[i + 1] = targets.size();
+    }
+    vector<int> component = findComponents(offsets, targets);
+
+    vector<pair<int, int>> gates;
+    for (int i = 0; i < count; i++)
+    {
+        if (position_of[tasks[i]->getId()] != i)
+            continue;
+        for (Task *subtask : tasks[i]->getSubtasks())
+        {
+            int id = subtask->getId();
+            int position = (id <= max_id) ? position_of[id] : -1;
+            if (position >= 0 && component[position] != component[i])
+                gates.push_back(make_pair(position, i));
+        }
+    }
+    return gates;
+}
@@ -0,0 +1,37 @@
+#ifndef CYCLE_FINDER_H
+#define CYCLE_FINDER_H
+
+#include <vector>
+#include <utility>
+#include "task.h"
+
+using namespace std;
+
+// OOP Concept: Encapsulation - Finds every dependency cycle in one pass
+// Tarjan's strongly connected components algorithm with an explicit stack and
+// dense arrays, so it runs in O(V + E) and deep graphs cannot overflow the call
+// stack. Each component with more than one task, or a task that depends on
+// itself, is a cycle; breaking one edge inside every component removes all cycles.
+
+class CycleFinder
+{
+public:
+    // Member task IDs of every cycle, ascending within a cycle, cycles ordered
+    // by their smallest ID. Dependencies on tasks outside the list are ignored.
+    static vector<vector<int>> findCycles(const vector<Task *> &tasks);
+
+    // Strongly connected component of every node of a graph in CSR form
+    // (node i has edges to targets[offsets[i]] .. targets[offsets[i + 1] - 1])
+    static vector<int> findComponents(const vector<int> &offsets, const vector<int> &targets);
+
+    // The subtask rule shared by TaskExecutor (parallel mode), Simulator and
+    // CriticalPathScheduler: a parent waits for its subtasks, except for a subtask
+    // that depends on the parent directly or through other tasks, which would
+    // deadlock. Such a subtask shares a component of the wait-for graph
+    // (dependencies plus subtasks) with its parent. Returns the gating edges
+    // between pending tasks of the list as (subtask position, parent position).
+    // COMPLETED tasks wait for nothing and gate nothing.
+    static vector<pair<int, int>> findSubtaskGates(const vector<Task *> &tasks);
+};
+
+#endif // CYCLE_FINDER_H
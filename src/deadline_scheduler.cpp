@@ -9,6 +9,11 @@ static bool compareDeadline(const Task *a, const Task *b)
     return a->getDeadline() < b->getDeadline(); // Earliest deadline first
 }
 
+// Constructor
+DeadlineScheduler::DeadlineScheduler() : closed(false)
+{
+}
+
 // Schedule tasks by deadline (earliest first)
 vector<Task *> DeadlineScheduler::schedule(const vector<Task *> &tasks)
 {
@@ -22,3 +27,165 @@ string DeadlineScheduler::getName() const
 {
     return "DeadlineScheduler";
 }
+
+// ========== ONLINE EDF QUEUE ==========
+
+// Earliest deadline first, ties broken by ID so the order is deterministic
+bool DeadlineScheduler::isEarlier(const QueueEntry &a, const QueueEntry &b) const
+{
+    if (a.deadline != b.deadline)
+        return a.deadline < b.deadline;
+    return a.task->getId() < b.task->getId();
+}
+
+// Store an entry in a heap slot and remember where its task is
+void DeadlineScheduler::placeAt(size_t index, const QueueEntry &entry)
+{
+    heap[index] = entry;
+    heap_slot[entry.task->getId()] = index;
+}
+
+void DeadlineScheduler::siftUp(size_t index)
+{
+    QueueEntry task = heap[index];
+    while (index > 0)
+    {
+        size_t parent = (index - 1) / 2;
+        if (!isEarlier(task, heap[parent]))
+            break;
+        placeAt(index, heap[parent]);
+        index = parent;
+    }
+    placeAt(index, task);
+}
+
+void DeadlineScheduler::siftDown(size_t index)
+{
+    QueueEntry task = heap[index];
+    size_t count = heap.size();
+    while (2 * index + 1 < count)
+    {
+        size_t child = 2 * index + 1;
+        if (child + 1 < count && isEarlier(heap[child + 1], heap[child]))
+            child++;
+        if (!isEarlier(heap[child], task))
+            break;
+        placeAt(index, heap[child]);
+        index = child;
+    }
+    placeAt(index, task);
+}
+
+// Remove and return the earliest task (heap must not be empty)
+Task *DeadlineScheduler::removeTop()
+{
+    Task *top = heap.front().task;
+    heap_slot[top->getId()] = -1;
+    QueueEntry last = heap.back();
+    heap.pop_back();
+    if (!heap.empty())
+    {
+        heap[0] = last;
+        siftDown(0);
+    }
+    return top;
+}
+
+// Queue a task; a task that is already queued is left where it is
+void DeadlineScheduler::submit(Task *task)
+{
+    if (task == nullptr)
+        return;
+    {
+        lock_guard<mutex> guard(lock);
+        int id = task->getId();
+        if (id >= (int)heap_slot.size())
+            heap_slot.resize(id + 1, -1);
+        if (heap_slot[id] != -1)
+            return;
+
+        // A deadline changed through the queue wins over the one the task still holds
+        QueueEntry entry = {task->getDeadline(), task};
+        if (id < (int)has_pending.size() && has_pending[id])
+            entry.deadline = new_deadline[id];
+        heap.push_back(entry);
+        siftUp(heap.size() - 1);
+    }
+    available.notify_one();
+}
+
+// Record a task's new deadline and restore heap order around it
+// The task itself is updated later by applyDeadlineChanges on the owner thread
+void DeadlineScheduler::updateDeadline(Task *task, int deadline)
+{
+    lock_guard<mutex> guard(lock);
+    int id = task->getId();
+    if (id >= (int)new_deadline.size())
+    {
+        new_deadline.resize(id + 1, 0);
+        has_pending.resize(id + 1, 0);
+    }
+    if (!has_pending[id])
+    {
+        has_pending[id] = 1;
+        changed.push_back(task);
+    }
+    new_deadline[id] = deadline;
+
+    if (id >= (int)heap_slot.size() || heap_slot[id] == -1)
+        return;
+    QueueEntry &entry = heap[heap_slot[id]];
+    int old_deadline = entry.deadline;
+    entry.deadline = deadline;
+    if (deadline < old_deadline)
+        siftUp(heap_slot[id]);
+    else
+        siftDown(heap_slot[id]);
+}
+
+// Writes under the lock, so a concurrent submit never reads a deadline being written
+void DeadlineScheduler::applyDeadlineChanges()
+{
+    lock_guard<mutex> guard(lock);
+    for (Task *task : changed)
+    {
+        task->setDeadline(new_deadline[task->getId()]);
+        has_pending[task->getId()] = 0;
+    }
+    changed.clear();
+}
+
+Task *DeadlineScheduler::popEarliest()
+{
+    lock_guard<mutex> guard(lock);
+    return heap.empty() ? nullptr : removeTop();
+}
+
+Task *DeadlineScheduler::waitForEarliest()
+{
+    unique_lock<mutex> guard(lock);
+    while (heap.empty() && !closed)
+        available.wait(guard);
+    return heap.empty() ? nullptr : removeTop();
+}
+
+void DeadlineScheduler::close()
+{
+    {
+        lock_guard<mutex> guard(lock);
+        closed = true;
+    }
+    available.notify_all();
+}
+
+void DeadlineScheduler::reopen()
+{
+    lock_guard<mutex> guard(lock);
+    closed = false;
+}
+
+size_t DeadlineScheduler::pendingCount() const
+{
+    lock_guard<mutex> guard(lock);
+    return heap.size();
+}
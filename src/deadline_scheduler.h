@@ -2,19 +2,67 @@
 #define DEADLINE_SCHEDULER_H
 
 #include "scheduler.h"
+#include <mutex>
+#include <condition_variable>
 
 using namespace std;
 
 // OOP Concept: Inheritance - DeadlineScheduler inherits from Scheduler
 // OOP Concept: Polymorphism - Implements abstract schedule() method
+// Besides the batch schedule() it works as an online earliest-deadline-first queue:
+// an indexed binary heap that accepts new tasks and deadline changes in O(log n)
+// from any thread while an executor drains it (see TaskExecutor::runOnline).
+// Producers never write to a task: a changed deadline is kept in the queue
+// (in the heap entry, under the lock) until the owner thread, the one that
+// drains the queue, writes it to the task with applyDeadlineChanges().
+// Limits: the queue only streams tasks that already exist, because
+// TaskManager::createTask is not thread-safe, so create the graph first and
+// let producers submit and re-prioritize it. The drain runs on the calling
+// thread alone; TaskExecutor's worker count does not apply. bench/bench.cpp
+// ("online") drives it with concurrent producers.
 
 class DeadlineScheduler : public Scheduler
 {
+private:
+    // Online EDF queue state
+    struct QueueEntry
+    {
+        int deadline; // Deadline the task is ordered by
+        Task *task;
+    };
+    vector<QueueEntry> heap;  // Binary min-heap on (deadline, id)
+    vector<int> heap_slot;    // Task ID -> index in heap, -1 if not queued
+    vector<int> new_deadline; // Task ID -> deadline not yet written to the task
+    vector<char> has_pending; // Task ID -> new_deadline holds a value (any int is a valid deadline)
+    vector<Task *> changed;   // Tasks with has_pending set
+    bool closed;
+    mutable mutex lock;
+    condition_variable available;
+
+    // Heap helpers (caller holds lock)
+    bool isEarlier(const QueueEntry &a, const QueueEntry &b) const;
+    void placeAt(size_t index, const QueueEntry &entry);
+    void siftUp(size_t index);
+    void siftDown(size_t index);
+    Task *removeTop();
+
 public:
+    DeadlineScheduler();
+
     // OOP Concept: Polymorphism - Override pure virtual function
     vector<Task *> schedule(const vector<Task *> &tasks) override;
 
     string getName() const override;
+
+    // Online EDF interface (thread-safe)
+    void submit(Task *task);                     // Queue a task, O(log n)
+    void updateDeadline(Task *task, int deadline); // Change deadline, O(log n) if queued
+    void applyDeadlineChanges();                 // Owner thread only: write changed deadlines to the tasks
+    Task *popEarliest();                         // Non-blocking, nullptr if empty
+    Task *waitForEarliest();                     // Blocks until a task arrives, nullptr once closed and empty
+    void close();                                // No more submissions, lets waiters finish
+    void reopen();
+    size_t pendingCount() const;
 };
 
 #endif // DEADLINE_SCHEDULER_H
@@ -0,0 +1,91 @@
+#include "epoch_reclaimer.h"
+#include <thread>
+
+using namespace std;
+
+// Threads start their slot search at different places so concurrent readers
+// rarely race for the same slot
+static atomic<int> next_reader_hint(0);
+
+// Constructor - epoch 0 marks a free slot, so counting starts at 1
+EpochReclaimer::EpochReclaimer() : global_epoch(1)
+{
+}
+
+EpochReclaimer::~EpochReclaimer()
+{
+    for (const Retired &entry : retired)
+        entry.destroy(entry.object);
+}
+
+// The pinned value may be older than the epoch by the time the slot is
+// claimed; that only delays reclamation, it never frees too early
+int EpochReclaimer::enter()
+{
+    static thread_local int hint = next_reader_hint.fetch_add(1, memory_order_relaxed) % MAX_READERS;
+    while (true)
+    {
+        uint64_t epoch = global_epoch.load();
+        for (int i = 0; i < MAX_READERS; i++)
+        {
+            int slot = (hint + i) % MAX_READERS;
+            uint64_t free_slot = 0;
+            if (readers[slot].epoch.load(memory_order_relaxed) == 0 &&
+                readers[slot].epoch.compare_exchange_strong(free_slot, epoch))
+                return slot;
+        }
+        this_thread::yield();
+    }
+}
+
+void EpochReclaimer::exit(int slot)
+{
+    readers[slot].epoch.store(0, memory_order_release);
+}
+
+// The object was unpublished before this call, so a reader can only hold it
+// if it pinned an epoch no later than the one read here
+void EpochReclaimer::retireObject(void *object, void (*destroy)(void *))
+{
+    uint64_t epoch = global_epoch.fetch_add(1);
+    {
+        lock_guard<mutex> guard(retired_lock);
+        retired.push_back(Retired{object, destroy, epoch});
+    }
+    reclaim();
+}
+
+// Readers are scanned under the lock: an object retired after the scan
+// could be held by a reader that pinned after it
+size_t EpochReclaimer::reclaim()
+{
+    vector<Retired> expired;
+    {
+        lock_guard<mutex> guard(retired_lock);
+        uint64_t oldest = UINT64_MAX;
+        for (const ReaderSlot &reader : readers)
+        {
+            uint64_t epoch = reader.epoch.load();
+            if (epoch != 0 && epoch < oldest)
+                oldest = epoch;
+        }
+        size_t kept = 0;
+        for (const Retired &entry : retired)
+        {
+            if (entry.epoch < oldest)
+                expired.push_back(entry);
+            else
+                retired[kept++] = entry;
+        }
+        retired.resize(kept);
+    }
+    for (const Retired &entry : expired)
+        entry.destroy(entry.object);
+    return expired.size();
+}
+
+size_t EpochReclaimer::getRetiredCount()
+{
+    lock_guard<mutex> guard(retired_lock);
+    return retired.size();
+}
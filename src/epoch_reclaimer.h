@@ -0,0 +1,75 @@
+#ifndef EPOCH_RECLAIMER_H
+#define EPOCH_RECLAIMER_H
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <cstdint>
+
+using namespace std;
+
+// OOP Concept: Encapsulation - Epoch-based memory reclamation (RCU style)
+// Readers pin the current epoch while they use shared objects. A writer that
+// replaces an object retires the old one, and it is deleted once no reader
+// that could still see it is pinned. Pinning is one compare-and-swap on a
+// reader slot with its own cache line, so readers never wait for writers and
+// writers never wait for readers; only retiring takes a (writer-side) lock.
+//
+// Protocol: publish the replacement first (a sequentially consistent store or
+// exchange of the shared pointer), then retire the old object.
+
+class EpochReclaimer
+{
+private:
+    static const int MAX_READERS = 64; // Further readers spin until a slot frees
+
+    struct alignas(64) ReaderSlot
+    {
+        atomic<uint64_t> epoch; // Pinned epoch, 0 when the slot is free
+        ReaderSlot() : epoch(0) {}
+    };
+
+    struct Retired
+    {
+        void *object;
+        void (*destroy)(void *);
+        uint64_t epoch; // Readers pinned at or before this epoch may hold it
+    };
+
+    ReaderSlot readers[MAX_READERS];
+    alignas(64) atomic<uint64_t> global_epoch;
+    mutex retired_lock;
+    vector<Retired> retired;
+
+    template <typename T>
+    static void destroyObject(void *object)
+    {
+        delete static_cast<T *>(object);
+    }
+
+    void retireObject(void *object, void (*destroy)(void *));
+
+public:
+    EpochReclaimer();
+    // Deletes everything still retired; no reader may be pinned
+    ~EpochReclaimer();
+    EpochReclaimer(const EpochReclaimer &) = delete;
+    EpochReclaimer &operator=(const EpochReclaimer &) = delete;
+
+    // Pin the current epoch; returns the slot to pass to exit()
+    int enter();
+    void exit(int slot);
+
+    // Delete object once every reader that might hold it has exited
+    template <typename T>
+    void retire(const T *object)
+    {
+        retireObject(const_cast<T *>(object), &destroyObject<T>);
+    }
+
+    // Delete the retired objects no pinned reader can reach, returns how many
+    size_t reclaim();
+    size_t getRetiredCount();
+};
+
+#endif // EPOCH_RECLAIMER_H
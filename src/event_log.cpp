@@ -0,0 +1,176 @@
+#include "event_log.h"
+#include "execution_metrics.h"
+#include "task.h"
+#include <chrono>
+#include <cstring>
+#include <cerrno>
+
+using namespace std;
+
+// Records written to the file per fwrite
+static const size_t DRAIN_BATCH = 4096;
+
+// Constructor
+EventLog::EventLog(size_t capacity)
+    : enqueue_position(0), dequeue_position(0), dropped(0), written(0), file(nullptr), stopping(false), failed(false)
+{
+    size_t size = 1;
+    while (size < capacity)
+        size <<= 1;
+    ring = vector<Slot>(size);
+    mask = size - 1;
+    for (size_t i = 0; i < size; i++)
+        ring[i].sequence.store(i, memory_order_relaxed);
+}
+
+EventLog::~EventLog()
+{
+    close();
+}
+
+bool EventLog::open(const string &path, string &error)
+{
+    close();
+    failed = false;
+    error_message.clear();
+    file = fopen(path.c_str(), "wb");
+    if (file == nullptr)
+    {
+        error = "cannot create " + path;
+        return false;
+    }
+    // Unbuffered: the drain already writes in large batches, and fwrite's count
+    // then says how many records really reached the file
+    setvbuf(file, nullptr, _IONBF, 0);
+    uint32_t header[2] = {EVENT_LOG_VERSION, sizeof(EventRecord)};
+    if (fwrite(EVENT_LOG_MAGIC, 1, 8, file) != 8 || fwrite(header, sizeof(header), 1, file) != 1)
+    {
+        error = "cannot write " + path;
+        fclose(file);
+        file = nullptr;
+        return false;
+    }
+    stopping.store(false);
+    drain_thread = thread(&EventLog::drainLoop, this);
+    return true;
+}
+
+bool EventLog::close()
+{
+    if (file == nullptr)
+        return !failed;
+    stopping.store(true);
+    drain_thread.join();
+    if (fclose(file) != 0)
+        fail("close");
+    file = nullptr;
+    return !failed;
+}
+
+void EventLog::fail(const string &what)
+{
+    if (failed)
+        return;
+    failed = true;
+    error_message = what + " failed: " + strerror(errno);
+}
+
+bool EventLog::isOpen() const { return file != nullptr; }
+
+// Claim the next slot whose sequence says it is free, then publish the record
+// by advancing that slot's sequence (Vyukov's bounded MPMC queue)
+void EventLog::log(EventRecordType type, int task_id, int64_t value, int worker)
+{
+    if (file == nullptr)
+        return;
+    uint64_t position = enqueue_position.load(memory_order_relaxed);
+    Slot *slot;
+    while (true)
+    {
+        slot = &ring[position & mask];
+        uint64_t sequence = slot->sequence.load(memory_order_acquire);
+        int64_t difference = (int64_t)sequence - (int64_t)position;
+        if (difference == 0)
+        {
+            if (enqueue_position.compare_exchange_weak(position, position + 1, memory_order_relaxed))
+                break;
+        }
+        else if (difference < 0)
+        {
+            dropped.fetch_add(1, memory_order_relaxed); // Ring full
+            return;
+        }
+        else
+            position = enqueue_position.load(memory_order_relaxed);
+    }
+    slot->record.time_ns = ExecutionMetrics::now();
+    slot->record.sequence = position;
+    slot->record.value = value;
+    slot->record.task_id = task_id;
+    slot->record.type = type;
+    slot->record.worker = worker;
+    slot->sequence.store(position + 1, memory_order_release);
+}
+
+bool EventLog::tryPop(EventRecord &record)
+{
+    Slot &slot = ring[dequeue_position & mask];
+    if (slot.sequence.load(memory_order_acquire) != dequeue_position + 1)
+        return false;
+    record = slot.record;
+    slot.sequence.store(dequeue_position + mask + 1, memory_order_release);
+    dequeue_position++;
+    return true;
+}
+
+// Write whatever is queued in large blocks; sleep briefly when the ring is empty.
+// After close() is requested, keep going until the ring is empty.
+void EventLog::drainLoop()
+{
+    vector<EventRecord> batch(DRAIN_BATCH);
+    while (true)
+    {
+        bool finishing = stopping.load();
+        size_t count = 0;
+        while (count < DRAIN_BATCH && tryPop(batch[count]))
+            count++;
+        // After a failed write the ring is still drained, so producers keep
+        // logging without blocking, but nothing more goes to the file
+        if (count > 0 && !failed)
+        {
+            size_t stored = fwrite(batch.data(), sizeof(EventRecord), count, file);
+            written.fetch_add(stored, memory_order_relaxed);
+            if (stored != count)
+                fail("write");
+        }
+        if (count == DRAIN_BATCH)
+            continue;
+        if (finishing)
+            break;
+        this_thread::sleep_for(chrono::milliseconds(1));
+    }
+    if (fflush(file) != 0)
+        fail("flush");
+}
+
+void EventLog::onRunStarted(const string &scheduler_name, int workers)
+{
+    (void)scheduler_name;
+    log(EVENT_RUN_STARTED, 0, workers);
+}
+
+void EventLog::onTaskStarted(Task *task, int worker_id)
+{
+    log(EVENT_TASK_STARTED, task->getId(), task->getEstimatedTime(), worker_id);
+}
+
+void EventLog::onTaskCompleted(Task *task, int worker_id)
+{
+    log(EVENT_TASK_COMPLETED, task->getId(), task->getEstimatedTime(), worker_id);
+}
+
+uint64_t EventLog::getWrittenCount() const { return written.load(); }
+
+uint64_t EventLog::getDroppedCount() const { return dropped.load(); }
+
+const string &EventLog::getError() const { return error_message; }
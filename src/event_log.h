@@ -0,0 +1,112 @@
+#ifndef EVENT_LOG_H
+#define EVENT_LOG_H
+
+#include <string>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <cstdio>
+#include <cstdint>
+#include "execution_listener.h"
+
+using namespace std;
+
+// Binary log of execution and graph events, a structured alternative to the
+// colored text output
+//
+// File layout:
+//   "HTSEEVNT" | uint32 version | uint32 record_size
+//   records:   EventRecord (32 bytes each, host byte order)
+//
+// Records go into a fixed-size lock-free ring buffer (bounded multi-producer
+// queue with a sequence number per slot) and a background thread drains it to
+// the file in large writes. Logging is a clock read, one compare-and-swap and
+// a 32-byte store; when the ring is full the record is dropped and counted
+// instead of blocking the caller. tools/event_decode.cpp prints a log as text.
+
+#define EVENT_LOG_MAGIC "HTSEEVNT"
+#define EVENT_LOG_VERSION 1
+
+enum EventRecordType
+{
+    EVENT_RUN_STARTED = 1,    // value = worker count
+    EVENT_TASK_STARTED = 2,   // value = estimated time
+    EVENT_TASK_COMPLETED = 3, // value = estimated time
+    EVENT_TASK_CREATED = 4,   // value = priority
+    EVENT_SUBTASK_ADDED = 5,  // task = parent, value = subtask ID
+    EVENT_DEPENDENCY_ADDED = 6 // task = dependent, value = dependency ID
+};
+
+struct EventRecord
+{
+    uint64_t time_ns; // Monotonic clock
+    uint64_t sequence; // Order in which records were logged
+    int64_t value;     // Meaning depends on type
+    int32_t task_id;
+    uint16_t type;     // EventRecordType
+    uint16_t worker;   // Executing worker, 0 outside runs
+};
+
+// Name of a record type for decoders ("UNKNOWN" if not a known type)
+inline const char *eventTypeName(uint16_t type)
+{
+    static const char *const NAMES[] = {"UNKNOWN", "RUN_STARTED", "TASK_STARTED", "TASK_COMPLETED",
+                                        "TASK_CREATED", "SUBTASK_ADDED", "DEPENDENCY_ADDED"};
+    return type < sizeof(NAMES) / sizeof(NAMES[0]) ? NAMES[type] : NAMES[0];
+}
+
+// OOP Concept: Inheritance - EventLog is an ExecutionListener, so it records
+// task starts and completions from the executor's worker threads
+class EventLog : public ExecutionListener
+{
+private:
+    struct alignas(64) Slot
+    {
+        atomic<uint64_t> sequence;
+        EventRecord record;
+    };
+
+    vector<Slot> ring;
+    size_t mask;                         // ring.size() - 1 (size is a power of two)
+    alignas(64) atomic<uint64_t> enqueue_position;
+    alignas(64) uint64_t dequeue_position; // Drain thread only
+    atomic<uint64_t> dropped;
+    atomic<uint64_t> written;
+
+    FILE *file;
+    thread drain_thread;
+    atomic<bool> stopping;
+    bool failed;          // Drain thread only until close() has joined it
+    string error_message; // First failed write, flush or close
+
+    bool tryPop(EventRecord &record);
+    void drainLoop();
+    void fail(const string &what); // Keeps the first error only
+
+public:
+    // capacity is rounded up to a power of two
+    explicit EventLog(size_t capacity = 1 << 16);
+    ~EventLog();
+    EventLog(const EventLog &) = delete;
+    EventLog &operator=(const EventLog &) = delete;
+
+    // Create the file and start draining; false with a message on failure
+    bool open(const string &path, string &error);
+    // Drain every queued record, stop the thread and close the file; false if
+    // any write failed (see getError). Records after a failed write are discarded
+    bool close();
+    bool isOpen() const;
+
+    // Thread-safe; no-op when the log is closed
+    void log(EventRecordType type, int task_id, int64_t value, int worker = 0);
+
+    void onRunStarted(const string &scheduler_name, int workers) override;
+    void onTaskStarted(Task *task, int worker_id) override;
+    void onTaskCompleted(Task *task, int worker_id) override;
+
+    uint64_t getWrittenCount() const; // Records that reached the file
+    const string &getError() const;
+    uint64_t getDroppedCount() const; // Records lost because the ring was full
+};
+
+#endif // EVENT_LOG_H
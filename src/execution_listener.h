@@ -0,0 +1,36 @@
+#ifndef EXECUTION_LISTENER_H
+#define EXECUTION_LISTENER_H
+
+#include <string>
+
+class Task;
+
+// OOP Concept: Abstraction - Observer interface for task execution events
+// Callbacks are made on the worker thread that runs the task, so several
+// can arrive at the same time in parallel mode.
+class ExecutionListener
+{
+public:
+    virtual ~ExecutionListener() = default;
+
+    // Called on the executing thread before any task of a run starts; worker
+    // IDs of the run are 0 .. workers - 1
+    virtual void onRunStarted(const std::string &scheduler_name, int workers)
+    {
+        (void)scheduler_name;
+        (void)workers;
+    }
+
+    virtual void onTaskStarted(Task *task, int worker_id)
+    {
+        (void)task;
+        (void)worker_id;
+    }
+    virtual void onTaskCompleted(Task *task, int worker_id)
+    {
+        (void)task;
+        (void)worker_id;
+    }
+};
+
+#endif // EXECUTION_LISTENER_H
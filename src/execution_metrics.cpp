@@ -0,0 +1,84 @@
+#include "execution_metrics.h"
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
+using namespace std;
+
+static const char *const PHASE_LABELS[ExecutionMetrics::PHASE_COUNT] = {
+    "Scheduling", "Cycle check", "Task queue wait", "Task run"};
+
+static const char *const PHASE_METRICS[ExecutionMetrics::PHASE_COUNT] = {
+    "htse_schedule_seconds", "htse_cycle_check_seconds", "htse_task_wait_seconds", "htse_task_run_seconds"};
+
+static const char *const PHASE_HELP[ExecutionMetrics::PHASE_COUNT] = {
+    "Time spent in Scheduler::schedule",
+    "Time spent checking the dependency graph for cycles",
+    "Time from a task becoming ready to its start",
+    "Time from a task's start to its completion"};
+
+// Human-readable duration with three significant digits
+static string formatDuration(uint64_t ns)
+{
+    ostringstream text;
+    text << setprecision(3);
+    if (ns < 1000)
+        text << ns << " ns";
+    else if (ns < 1000000)
+        text << ns / 1e3 << " us";
+    else if (ns < 1000000000)
+        text << ns / 1e6 << " ms";
+    else
+        text << ns / 1e9 << " s";
+    return text.str();
+}
+
+uint64_t ExecutionMetrics::now()
+{
+    return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void ExecutionMetrics::record(Phase phase, uint64_t ns) { histograms[phase].record(ns); }
+
+const LatencyHistogram &ExecutionMetrics::getHistogram(Phase phase) const { return histograms[phase]; }
+
+void ExecutionMetrics::reset()
+{
+    for (int p = 0; p < PHASE_COUNT; p++)
+        histograms[p].reset();
+}
+
+void ExecutionMetrics::printReport(ostream &out) const
+{
+    out << "  " << left << setw(18) << "Phase" << right << setw(10) << "Count" << setw(11) << "p50"
+        << setw(11) << "p99" << setw(11) << "max" << "\n";
+    for (int p = 0; p < PHASE_COUNT; p++)
+    {
+        const LatencyHistogram &histogram = histograms[p];
+        if (histogram.getCount() == 0)
+            continue;
+        out << "  " << left << setw(18) << PHASE_LABELS[p] << right << setw(10) << histogram.getCount()
+            << setw(11) << formatDuration(histogram.valueAtPercentile(50))
+            << setw(11) << formatDuration(histogram.valueAtPercentile(99))
+            << setw(11) << formatDuration(histogram.getMax()) << "\n";
+    }
+}
+
+void ExecutionMetrics::writePrometheus(ostream &out) const
+{
+    static const double QUANTILES[] = {0.5, 0.9, 0.99};
+    for (int p = 0; p < PHASE_COUNT; p++)
+    {
+        const LatencyHistogram &histogram = histograms[p];
+        const char *name = PHASE_METRICS[p];
+        out << "# HELP " << name << " " << PHASE_HELP[p] << "\n"
+            << "# TYPE " << name << " summary\n";
+        for (double quantile : QUANTILES)
+            out << name << "{quantile=\"" << quantile << "\"} " << histogram.valueAtPercentile(quantile * 100) / 1e9 << "\n";
+        out << name << "_sum " << histogram.getTotal() / 1e9 << "\n"
+            << name << "_count " << histogram.getCount() << "\n"
+            << "# HELP " << name << "_max Longest recorded value\n"
+            << "# TYPE " << name << "_max gauge\n"
+            << name << "_max " << histogram.getMax() / 1e9 << "\n";
+    }
+}
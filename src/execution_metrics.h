@@ -0,0 +1,45 @@
+#ifndef EXECUTION_METRICS_H
+#define EXECUTION_METRICS_H
+
+#include <ostream>
+#include <cstdint>
+#include "latency_histogram.h"
+
+using namespace std;
+
+// OOP Concept: Composition - One latency histogram per instrumented phase
+// TaskManager times scheduling and cycle checks, TaskExecutor times how long each
+// task waited in the ready queue and how long it ran. Values accumulate for the
+// lifetime of the owner and are shown in the summary report or exported in the
+// Prometheus text format.
+
+class ExecutionMetrics
+{
+public:
+    enum Phase
+    {
+        SCHEDULE,    // Scheduler::schedule calls
+        CYCLE_CHECK, // hasCircularDependencies / findDependencyCycles
+        TASK_WAIT,   // Task became ready -> task started
+        TASK_RUN,    // Task started -> task completed
+        PHASE_COUNT
+    };
+
+private:
+    LatencyHistogram histograms[PHASE_COUNT];
+
+public:
+    // Monotonic clock in nanoseconds
+    static uint64_t now();
+
+    void record(Phase phase, uint64_t ns);
+    const LatencyHistogram &getHistogram(Phase phase) const;
+    void reset();
+
+    // Table of count/p50/p99/max for every phase with samples
+    void printReport(ostream &out) const;
+    // Prometheus text exposition format: one summary per phase plus a _max gauge
+    void writePrometheus(ostream &out) const;
+};
+
+#endif // EXECUTION_METRICS_H
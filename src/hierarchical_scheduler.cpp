@@ -7,22 +7,30 @@ using namespace std;
 vector<Task *> HierarchicalScheduler::schedule(const vector<Task *> &tasks)
 {
     vector<Task *> scheduled;
-    set<int> visited;
+    scheduled.reserve(tasks.size());
 
-    // Identify root tasks and subtasks
-    set<int> allTaskIds, subtaskIds;
+    // IDs are dense, so membership flags are plain arrays indexed by ID
+    int max_id = 0;
     for (Task *task : tasks)
     {
-        allTaskIds.insert(task->getId());
+        max_id = max(max_id, task->getId());
         for (Task *subtask : task->getSubtasks())
-            subtaskIds.insert(subtask->getId());
+            max_id = max(max_id, subtask->getId());
+    }
+    vector<char> visited(max_id + 1, 0), is_subtask(max_id + 1, 0);
+
+    // Identify subtasks (tasks that have a parent)
+    for (Task *task : tasks)
+    {
+        for (Task *subtask : task->getSubtasks())
+            is_subtask[subtask->getId()] = 1;
     }
 
     // Collect root tasks (not subtasks of any other task)
     vector<Task *> rootTasks;
     for (Task *task : tasks)
     {
-        if (subtaskIds.find(task->getId()) == subtaskIds.end())
+        if (!is_subtask[task->getId()])
             rootTasks.push_back(task);
     }
 
@@ -39,24 +47,37 @@ vector<Task *> HierarchicalScheduler::schedule(const vector<Task *> &tasks)
     sort(rootTasks.begin(), rootTasks.end(), PriorityCompare());
 
     // Traverse hierarchy depth-first
+    vector<Task *> stack;
     for (Task *root : rootTasks)
-        collectTasksInOrder(root, scheduled, visited);
+        collectTasksInOrder(root, scheduled, visited, stack);
 
     return scheduled;
 }
 
-// Recursively collect tasks in hierarchical order
-void HierarchicalScheduler::collectTasksInOrder(Task *task, vector<Task *> &result, set<int> &visited)
+// Collect tasks in hierarchical order (pre-order depth-first)
+// Uses an explicit stack instead of recursion so deep subtask chains cannot
+// overflow the call stack. Children are pushed in reverse so they are visited
+// in the same order as a recursive traversal.
+void HierarchicalScheduler::collectTasksInOrder(Task *root, vector<Task *> &result, vector<char> &visited, vector<Task *> &stack)
 {
-    if (task == nullptr || visited.find(task->getId()) != visited.end())
-        return;
+    stack.push_back(root);
+    while (!stack.empty())
+    {
+        Task *task = stack.back();
+        stack.pop_back();
+        if (task == nullptr || visited[task->getId()])
+            continue;
 
-    visited.insert(task->getId());
-    result.push_back(task);
+        visited[task->getId()] = 1;
+        result.push_back(task);
 
-    // Recursively add subtasks
-    for (Task *subtask : task->getSubtasks())
-        collectTasksInOrder(subtask, result, visited);
+        const vector<Task *> &subtasks = task->getSubtasks();
+        for (auto it = subtasks.rbegin(); it != subtasks.rend(); ++it)
+        {
+            if (!visited[(*it)->getId()])
+                stack.push_back(*it);
+        }
+    }
 }
 
 // Return scheduler name
@@ -2,7 +2,6 @@
 #define HIERARCHICAL_SCHEDULER_H
 
 #include "scheduler.h"
-#include <set>
 
 using namespace std;
 
@@ -13,8 +12,9 @@ class HierarchicalScheduler : public Scheduler
 {
 private:
     // Helper methods for hierarchical traversal
-    // OOP Concept: Recursion - Used in tree traversal
-    void collectTasksInOrder(Task *task, vector<Task *> &result, set<int> &visited);
+    // Iterative depth-first traversal with an explicit stack and a visited
+    // array indexed by task ID
+    void collectTasksInOrder(Task *root, vector<Task *> &result, vector<char> &visited, vector<Task *> &stack);
 
 public:
     // OOP Concept: Polymorphism - Override pure virtual function
@@ -0,0 +1,349 @@
+#include "journal.h"
+#include "task.h"
+#include <cstring>
+#include <cerrno>
+#ifdef _WIN32
+#include <io.h>
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+// Default number of records per group commit
+static const int DEFAULT_GROUP_SIZE = 512;
+static const size_t HEADER_SIZE = 16;
+
+// FNV-1a hash used as a record checksum
+static uint32_t checksum(const char *bytes, size_t length)
+{
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++)
+    {
+        hash ^= static_cast<unsigned char>(bytes[i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// Flush stdio buffers and force the data to disk
+static bool syncFile(FILE *file)
+{
+    if (fflush(file) != 0)
+        return false;
+#ifdef _WIN32
+    return _commit(_fileno(file)) == 0;
+#else
+    return fsync(fileno(file)) == 0;
+#endif
+}
+
+bool replaceFile(const string &src, const string &dst)
+{
+#ifdef _WIN32
+    return MoveFileExA(src.c_str(), dst.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+    return rename(src.c_str(), dst.c_str()) == 0;
+#endif
+}
+
+// ========== WRITER ==========
+
+Journal::Journal() : file(nullptr), pending_records(0), group_size(DEFAULT_GROUP_SIZE), record_count(0), flushing(false), failed(false)
+{
+}
+
+Journal::~Journal()
+{
+    close();
+}
+
+bool Journal::create(const string &path, uint32_t generation)
+{
+    close();
+    failed = false;
+    error_message.clear();
+    file = fopen(path.c_str(), "wb");
+    if (file == nullptr)
+    {
+        error_message = path + ": " + strerror(errno);
+        return false;
+    }
+
+    char header[HEADER_SIZE];
+    uint32_t version = JOURNAL_VERSION;
+    memcpy(header, JOURNAL_MAGIC, 8);
+    memcpy(header + 8, &version, 4);
+    memcpy(header + 12, &generation, 4);
+    if (fwrite(header, 1, HEADER_SIZE, file) != HEADER_SIZE || !syncFile(file))
+    {
+        error_message = path + ": " + strerror(errno);
+        fclose(file);
+        file = nullptr;
+        return false;
+    }
+    return true;
+}
+
+bool Journal::openForAppend(const string &path)
+{
+    close();
+    failed = false;
+    error_message.clear();
+    file = fopen(path.c_str(), "ab");
+    if (file == nullptr)
+        error_message = path + ": " + strerror(errno);
+    return file != nullptr;
+}
+
+bool Journal::close()
+{
+    unique_lock<mutex> guard(lock);
+    if (file == nullptr)
+        return !failed;
+    // Records logged while a group was being written still need writing
+    while (flushing || !pending.empty())
+        flushPending(guard);
+    if (fclose(file) != 0)
+        fail("close");
+    file = nullptr;
+    record_count = 0;
+    return !failed;
+}
+
+void Journal::fail(const string &what)
+{
+    if (failed)
+        return;
+    failed = true;
+    error_message = what + " failed: " + strerror(errno);
+}
+
+// Encode one record into the pending buffer, committing a full group
+// Caller holds lock (through the unique_lock it passes on)
+void Journal::append(unique_lock<mutex> &guard, JournalRecordType type, const int *values, int value_count, const string &name)
+{
+    if (file == nullptr || failed)
+        return;
+    uint32_t payload_size = 1 + value_count * 4 + name.size();
+    size_t start = pending.size();
+    pending.resize(start + 8 + payload_size);
+
+    char *record = pending.data() + start;
+    char *payload = record + 8;
+    payload[0] = static_cast<char>(type);
+    memcpy(payload + 1, values, value_count * 4);
+    if (!name.empty())
+        memcpy(payload + 1 + value_count * 4, name.data(), name.size());
+
+    uint32_t sum = checksum(payload, payload_size);
+    memcpy(record, &payload_size, 4);
+    memcpy(record + 4, &sum, 4);
+
+    pending_records++;
+    record_count++;
+    if (pending_records >= group_size)
+        flushPending(guard);
+}
+
+// Records appended before this call are either in pending or in the group a
+// writer already has in flight, so waiting for that writer and then writing
+// pending covers them all
+bool Journal::flushPending(unique_lock<mutex> &guard)
+{
+    while (flushing)
+        flushed.wait(guard);
+    if (failed)
+    {
+        // Writing past a lost group would leave a gap in the journal
+        pending.clear();
+        pending_records = 0;
+        return false;
+    }
+    if (file == nullptr || pending.empty())
+        return true;
+
+    writing.swap(pending);
+    pending.clear();
+    pending_records = 0;
+    flushing = true;
+    FILE *out = file;
+    guard.unlock();
+    bool written = fwrite(writing.data(), 1, writing.size(), out) == writing.size();
+    bool synced = written && syncFile(out);
+    int error = errno;
+    guard.lock();
+
+    if (!synced)
+    {
+        errno = error;
+        fail(written ? "fsync" : "write");
+    }
+    writing.clear();
+    flushing = false;
+    flushed.notify_all();
+    return !failed;
+}
+
+void Journal::logCreateTask(const string &name, int priority, int deadline, int time)
+{
+    int values[3] = {priority, deadline, time};
+    unique_lock<mutex> guard(lock);
+    append(guard, JOURNAL_CREATE, values, 3, name);
+}
+
+void Journal::logSubtask(int parent_id, int subtask_id)
+{
+    int values[2] = {parent_id, subtask_id};
+    unique_lock<mutex> guard(lock);
+    append(guard, JOURNAL_SUBTASK, values, 2, string());
+}
+
+void Journal::logDependency(int task_id, int dependency_id)
+{
+    int values[2] = {task_id, dependency_id};
+    unique_lock<mutex> guard(lock);
+    append(guard, JOURNAL_DEPENDENCY, values, 2, string());
+}
+
+void Journal::logCompletion(int task_id)
+{
+    unique_lock<mutex> guard(lock);
+    append(guard, JOURNAL_COMPLETE, &task_id, 1, string());
+}
+
+void Journal::logPriority(int task_id, int priority)
+{
+    int values[2] = {task_id, priority};
+    unique_lock<mutex> guard(lock);
+    append(guard, JOURNAL_PRIORITY, values, 2, string());
+}
+
+bool Journal::commit()
+{
+    unique_lock<mutex> guard(lock);
+    return flushPending(guard);
+}
+
+void Journal::setGroupSize(int records)
+{
+    lock_guard<mutex> guard(lock);
+    group_size = (records < 1) ? 1 : records;
+}
+
+long Journal::getRecordCount() const
+{
+    return record_count;
+}
+
+const string &Journal::getError() const
+{
+    return error_message;
+}
+
+void Journal::onTaskCompleted(Task *task, int worker_id)
+{
+    (void)worker_id;
+    logCompletion(task->getId());
+}
+
+// ========== READER ==========
+
+JournalReader::JournalReader() : position(0), generation(0), clean_end(false)
+{
+}
+
+bool JournalReader::open(const string &path, string &error)
+{
+    error.clear();
+    FILE *file = fopen(path.c_str(), "rb");
+    if (file == nullptr)
+    {
+        if (errno != ENOENT)
+            error = strerror(errno);
+        return false;
+    }
+    // Read to end of file rather than trusting ftell, which is meaningless for
+    // a directory or a pipe
+    data.clear();
+    char block[1 << 16];
+    size_t got;
+    while ((got = fread(block, 1, sizeof(block), file)) > 0)
+        data.insert(data.end(), block, block + got);
+    bool read_failed = ferror(file) != 0;
+    int read_errno = errno;
+    fclose(file);
+
+    uint32_t version = 0;
+    if (read_failed)
+    {
+        error = strerror(read_errno);
+        return false;
+    }
+    if (data.size() < HEADER_SIZE || memcmp(data.data(), JOURNAL_MAGIC, 8) != 0)
+    {
+        error = "not a journal file";
+        return false;
+    }
+    memcpy(&version, data.data() + 8, 4);
+    memcpy(&generation, data.data() + 12, 4);
+    if (version != JOURNAL_VERSION)
+    {
+        error = "unsupported journal version " + to_string(version);
+        return false;
+    }
+    position = HEADER_SIZE;
+    clean_end = (position == data.size());
+    return true;
+}
+
+bool JournalReader::next(JournalRecord &record)
+{
+    if (position + 8 > data.size())
+        return false;
+
+    uint32_t payload_size, sum;
+    memcpy(&payload_size, data.data() + position, 4);
+    memcpy(&sum, data.data() + position + 4, 4);
+    const char *payload = data.data() + position + 8;
+    if (payload_size == 0 || position + 8 + payload_size > data.size() || checksum(payload, payload_size) != sum)
+        return false;
+
+    record.type = static_cast<JournalRecordType>(payload[0]);
+    int value_count;
+    switch (record.type)
+    {
+    case JOURNAL_CREATE:
+        value_count = 3;
+        break;
+    case JOURNAL_SUBTASK:
+    case JOURNAL_DEPENDENCY:
+    case JOURNAL_PRIORITY:
+        value_count = 2;
+        break;
+    case JOURNAL_COMPLETE:
+        value_count = 1;
+        break;
+    default:
+        return false;
+    }
+    if (payload_size < 1 + (uint32_t)value_count * 4)
+        return false;
+    memcpy(record.values, payload + 1, value_count * 4);
+    record.name.assign(payload + 1 + value_count * 4, payload_size - 1 - value_count * 4);
+
+    position += 8 + payload_size;
+    clean_end = (position == data.size());
+    return true;
+}
+
+uint32_t JournalReader::getGeneration() const
+{
+    return generation;
+}
+
+bool JournalReader::reachedCleanEnd() const
+{
+    return clean_end;
+}
@@ -0,0 +1,129 @@
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdint>
+#include "execution_listener.h"
+
+using namespace std;
+
+// Append-only write-ahead journal of graph mutations and task completions
+//
+// File layout:
+//   "HTSEJRNL" | uint32 version | uint32 generation
+//   records:   uint32 payload_size | uint32 checksum | payload
+//   payload:   uint8 type, then
+//     CREATE      int32 priority, int32 deadline, int32 time, name bytes
+//     SUBTASK     int32 parent_id, int32 child_id
+//     DEPENDENCY  int32 task_id, int32 dependency_id
+//     COMPLETE    int32 task_id
+//     PRIORITY    int32 task_id, int32 priority
+//
+// The generation ties a journal to the snapshot written by the last compaction.
+// A torn record at the end (crash during a write) fails its checksum and ends replay.
+
+#define JOURNAL_MAGIC "HTSEJRNL"
+#define JOURNAL_VERSION 1
+
+enum JournalRecordType
+{
+    JOURNAL_CREATE = 1,
+    JOURNAL_SUBTASK = 2,
+    JOURNAL_DEPENDENCY = 3,
+    JOURNAL_COMPLETE = 4,
+    JOURNAL_PRIORITY = 5
+};
+
+// One decoded record (fields used depend on type)
+struct JournalRecord
+{
+    JournalRecordType type;
+    int values[3];
+    string name;
+};
+
+// Writer with group commit: records are buffered and written + fsynced
+// together once group_size records are pending, or on commit(). The write and
+// fsync run outside the append lock, so other threads keep logging meanwhile;
+// one thread writes at a time, and records appended during its fsync form the
+// next group. The first failed write or fsync is kept (see getError) and every
+// later commit() reports it.
+// OOP Concept: Inheritance - Journal is an ExecutionListener so it can record completions
+class Journal : public ExecutionListener
+{
+private:
+    FILE *file;
+    vector<char> pending;  // Encoded records not yet written
+    vector<char> writing;  // Group being written by the flushing thread
+    int pending_records;
+    int group_size;
+    long record_count;     // Records appended since open
+    bool flushing;         // A thread is writing a group outside the lock
+    bool failed;
+    string error_message;  // First write/fsync failure
+    mutex lock;
+    condition_variable flushed;
+
+    void append(unique_lock<mutex> &guard, JournalRecordType type, const int *values, int value_count, const string &name);
+    bool flushPending(unique_lock<mutex> &guard); // Caller holds guard; drops it while writing
+    void fail(const string &what);                // Caller holds lock
+
+public:
+    Journal();
+    ~Journal();
+    Journal(const Journal &) = delete;
+    Journal &operator=(const Journal &) = delete;
+
+    // Start a new empty journal (replaces any existing file)
+    bool create(const string &path, uint32_t generation);
+    // Continue appending to an existing, fully valid journal
+    bool openForAppend(const string &path);
+    // Writes what is buffered; false if that or any earlier write failed
+    bool close();
+
+    void logCreateTask(const string &name, int priority, int deadline, int time);
+    void logSubtask(int parent_id, int subtask_id);
+    void logDependency(int task_id, int dependency_id);
+    void logCompletion(int task_id);
+    void logPriority(int task_id, int priority);
+
+    // Write and fsync everything buffered; false if that or any earlier write failed
+    bool commit();
+    void setGroupSize(int records);
+    long getRecordCount() const;
+    const string &getError() const;
+
+    // ExecutionListener: journal every completion
+    void onTaskCompleted(Task *task, int worker_id) override;
+};
+
+// Sequential reader used for replay
+class JournalReader
+{
+private:
+    vector<char> data;
+    size_t position;
+    uint32_t generation;
+    bool clean_end; // True if the last record ended exactly at end of file
+
+public:
+    JournalReader();
+
+    // Returns false if the file is missing (error left empty) or cannot be
+    // used as a journal: unreadable, no valid header or another version
+    bool open(const string &path, string &error);
+    // Next valid record, false at end of file or at the first damaged record
+    bool next(JournalRecord &record);
+
+    uint32_t getGeneration() const;
+    bool reachedCleanEnd() const;
+};
+
+// Atomically replace dst with src (rename over an existing file)
+bool replaceFile(const string &src, const string &dst);
+
+#endif // JOURNAL_H
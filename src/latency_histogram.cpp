@@ -0,0 +1,75 @@
+#include "latency_histogram.h"
+
+using namespace std;
+
+// Constructor
+LatencyHistogram::LatencyHistogram()
+{
+    reset();
+}
+
+// Values below 64 map to themselves; above that the top six significant bits
+// pick the sub-bucket and the shift picks the power of two
+int LatencyHistogram::bucketOf(uint64_t ns)
+{
+    int msb = 63 - __builtin_clzll(ns | 1);
+    int shift = (msb > SUB_BUCKET_BITS) ? msb - SUB_BUCKET_BITS : 0;
+    return (shift << SUB_BUCKET_BITS) + static_cast<int>(ns >> shift);
+}
+
+uint64_t LatencyHistogram::highestValueIn(int bucket)
+{
+    int sub_count = 1 << SUB_BUCKET_BITS;
+    if (bucket < 2 * sub_count)
+        return bucket;
+    int shift = (bucket >> SUB_BUCKET_BITS) - 1;
+    uint64_t sub = (bucket & (sub_count - 1)) + sub_count;
+    return ((sub + 1) << shift) - 1;
+}
+
+void LatencyHistogram::record(uint64_t ns)
+{
+    counts[bucketOf(ns)].fetch_add(1, memory_order_relaxed);
+    total_count.fetch_add(1, memory_order_relaxed);
+    total_ns.fetch_add(ns, memory_order_relaxed);
+    uint64_t seen = max_ns.load(memory_order_relaxed);
+    while (ns > seen && !max_ns.compare_exchange_weak(seen, ns, memory_order_relaxed))
+    {
+    }
+}
+
+void LatencyHistogram::reset()
+{
+    for (int i = 0; i < BUCKET_COUNT; i++)
+        counts[i].store(0, memory_order_relaxed);
+    total_count.store(0, memory_order_relaxed);
+    total_ns.store(0, memory_order_relaxed);
+    max_ns.store(0, memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::getCount() const { return total_count.load(memory_order_relaxed); }
+
+uint64_t LatencyHistogram::getTotal() const { return total_ns.load(memory_order_relaxed); }
+
+uint64_t LatencyHistogram::getMax() const { return max_ns.load(memory_order_relaxed); }
+
+uint64_t LatencyHistogram::valueAtPercentile(double percentile) const
+{
+    uint64_t count = getCount();
+    if (count == 0)
+        return 0;
+    uint64_t target = static_cast<uint64_t>(percentile / 100.0 * count + 0.5);
+    if (target < 1)
+        target = 1;
+    uint64_t seen = 0, max_value = getMax();
+    for (int i = 0; i < BUCKET_COUNT; i++)
+    {
+        seen += counts[i].load(memory_order_relaxed);
+        if (seen >= target)
+        {
+            uint64_t value = highestValueIn(i);
+            return value < max_value ? value : max_value;
+        }
+    }
+    return max_value;
+}
@@ -0,0 +1,45 @@
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <atomic>
+#include <cstdint>
+
+using namespace std;
+
+// OOP Concept: Encapsulation - Log-linear (HDR-style) histogram of durations in
+// nanoseconds. Each power of two is split into 32 equal sub-buckets, so any
+// reported percentile is within about 3% of the true value over the full
+// 64-bit range, in a fixed 15 KB of counters. Recording is a few shifts and a
+// relaxed atomic increment, safe from any number of threads.
+
+class LatencyHistogram
+{
+private:
+    static const int SUB_BUCKET_BITS = 5; // 32 sub-buckets per power of two
+    static const int BUCKET_COUNT = (64 - SUB_BUCKET_BITS + 1) << SUB_BUCKET_BITS;
+
+    atomic<uint64_t> counts[BUCKET_COUNT];
+    atomic<uint64_t> total_count;
+    atomic<uint64_t> total_ns;
+    atomic<uint64_t> max_ns;
+
+    static int bucketOf(uint64_t ns);
+    static uint64_t highestValueIn(int bucket);
+
+public:
+    LatencyHistogram();
+    LatencyHistogram(const LatencyHistogram &) = delete;
+    LatencyHistogram &operator=(const LatencyHistogram &) = delete;
+
+    void record(uint64_t ns);
+    void reset();
+
+    uint64_t getCount() const;
+    uint64_t getTotal() const; // Sum of all recorded values
+    uint64_t getMax() const;
+    // Smallest bucket bound with at least percentile% of the values at or
+    // below it (never above the exact maximum); 0 when empty
+    uint64_t valueAtPercentile(double percentile) const;
+};
+
+#endif // LATENCY_HISTOGRAM_H
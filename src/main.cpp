@@ -1,12 +1,283 @@
 #include "task_manager.h"
+#include "batch_loader.h"
+#include "trace_recorder.h"
+#include "event_log.h"
+#include "priority_scheduler.h"
+#ifndef D2_MODE
+#include "deadline_scheduler.h"
+#include "hierarchical_scheduler.h"
+#include "critical_path_scheduler.h"
+#include "optimizing_scheduler.h"
+#endif
 #include <iostream>
+#include <fstream>
+#include <cstdlib>
+#include <cstring>
 
 using namespace std;
 
+// Print command line help
+static void printUsage(const char *program)
+{
+    cout << "Usage:\n"
+         << "  " << program << "                      Interactive menu\n"
+         << "  " << program << " --journal <file>     Interactive menu, recovering from and logging to a journal\n"
+         << "  " << program << " --batch <file> [options]\n"
+         << "  " << program << " --load-snapshot <file> [options]\n\n"
+         << "Batch options:\n"
+         << "  --scheduler <priority|deadline|hierarchical|criticalpath|optimized>   (default: priority)\n"
+         << "  --workers <n>       Worker threads (default: 1)\n"
+         << "  --budget <ms>       Search time of the optimized scheduler (default: 2000)\n"
+         << "  --report <file>     Write the summary report to a file (default: stdout)\n"
+         << "  --log <file>        Write the execution log to a file (default: discarded)\n"
+         << "  --metrics <file>    Write latency histograms in the Prometheus text format\n"
+         << "  --trace <file>      Write a Chrome trace-event timeline of the execution\n"
+         << "  --events <file>     Write a binary event log (decode with tools/event_decode)\n"
+         << "  --save-snapshot <file>  Save the loaded graph as a binary snapshot before executing\n"
+         << "  --journal <file>    Log the graph and every completion; a rerun resumes from it\n"
+         << "                      instead of loading the input again\n"
+         << "  --simulate          Simulate execution on a virtual clock instead of running tasks\n";
+}
+
+// Headless mode: load a graph from a file, execute it, write the report
+static int runBatch(const string &input, const string &snapshot_in, const string &snapshot_out,
+                    const string &scheduler, int workers, int budget_ms, const string &report_path,
+                    const string &log_path, const string &metrics_path, const string &trace_path, const string &events_path,
+                    const string &journal_path, bool simulate)
+{
+    ofstream log_file; // Left closed when no log is wanted, so writes are dropped
+    if (!log_path.empty())
+        log_file.open(log_path);
+
+    TaskManager manager(log_file);
+    TraceRecorder trace;
+    if (!trace_path.empty())
+        manager.addExecutionListener(&trace);
+    EventLog events(1 << 18); // Room for bursts of graph events while loading
+    if (!events_path.empty())
+    {
+        string error;
+        if (!events.open(events_path, error))
+        {
+            cerr << "Cannot open event log: " << error << endl;
+            return 1;
+        }
+        manager.setEventLog(&events);
+    }
+    manager.setExecutionDelay(0);
+    manager.setQuietExecution(log_path.empty());
+    manager.setWorkerCount(workers);
+
+#ifndef D2_MODE
+    if (scheduler == "deadline")
+        manager.setScheduler(make_unique<DeadlineScheduler>());
+    else if (scheduler == "hierarchical")
+        manager.setScheduler(make_unique<HierarchicalScheduler>());
+    else if (scheduler == "criticalpath")
+        manager.setScheduler(make_unique<CriticalPathScheduler>());
+    else if (scheduler == "optimized")
+        manager.setScheduler(make_unique<OptimizingScheduler>(make_unique<CriticalPathScheduler>(), workers, budget_ms));
+    else if (scheduler != "priority")
+    {
+        cerr << "Unknown scheduler: " << scheduler << endl;
+        return 2;
+    }
+#else
+    (void)budget_ms;
+    if (scheduler != "priority")
+        cerr << "D2 build: only PriorityScheduler is available" << endl;
+#endif
+
+    // A journal that already holds a graph replaces the input, and the tasks
+    // it recorded as completed are not run again
+    bool recovered = false;
+    if (!journal_path.empty() && TaskManager::journalExists(journal_path))
+    {
+        string error;
+        if (!manager.openJournal(journal_path, error))
+        {
+            cerr << "Cannot open journal " << journal_path << ": " << error << endl;
+            return 1;
+        }
+        recovered = manager.getTaskCount() > 0;
+        if (!recovered)
+            manager.closeJournal(); // Load the input first, see below
+    }
+
+    if (recovered)
+    {
+        cerr << "Recovered " << manager.getTaskCount() << " tasks from journal " << journal_path << endl;
+        cerr << "Warning: ignoring " << (snapshot_in.empty() ? input : snapshot_in)
+             << "; delete " << journal_path << " and " << journal_path << ".snap to start over" << endl;
+    }
+    else if (!snapshot_in.empty())
+    {
+        string error;
+        if (!manager.loadSnapshot(snapshot_in, error))
+        {
+            cerr << "Error in " << snapshot_in << ": " << error << endl;
+            return 1;
+        }
+        cerr << "Loaded snapshot " << snapshot_in << endl;
+    }
+    else
+    {
+        BatchLoader loader(manager);
+        if (!loader.loadFile(input))
+        {
+            cerr << "Error in " << input << ": " << loader.getError() << endl;
+            return 1;
+        }
+        cerr << "Loaded " << loader.getTaskCount() << " tasks and " << loader.getEdgeCount() << " edges" << endl;
+    }
+
+    if (!snapshot_out.empty() && !manager.saveSnapshot(snapshot_out))
+    {
+        cerr << "Cannot write snapshot to " << snapshot_out << endl;
+        return 1;
+    }
+
+    if (manager.hasCircularDependencies())
+    {
+        cerr << "Circular dependencies found, nothing executed" << endl;
+        vector<vector<int>> cycles = manager.findDependencyCycles();
+        for (size_t i = 0; i < cycles.size(); i++)
+        {
+            cerr << "Cycle " << (i + 1) << " (" << cycles[i].size() << " tasks):";
+            for (int id : cycles[i])
+                cerr << " " << id;
+            cerr << endl;
+        }
+        return 1;
+    }
+
+    // The input is journaled only once it loaded and passed the cycle check,
+    // as one snapshot instead of a record per line
+    if (!journal_path.empty() && !recovered)
+    {
+        string error;
+        if (!manager.startJournal(journal_path, error))
+        {
+            cerr << "Cannot open journal " << journal_path << ": " << error << endl;
+            return 1;
+        }
+    }
+    int status = 0;
+    SimulationResult result;
+    if (simulate)
+        manager.simulateAll(result);
+    else if (!manager.executeAll())
+    {
+        // The run finished but is not durable; still write the report
+        cerr << "Journal write failed: " << manager.getJournalError() << endl;
+        status = 1;
+    }
+
+    ofstream report_file;
+    if (!report_path.empty())
+    {
+        report_file.open(report_path);
+        if (!report_file)
+        {
+            cerr << "Cannot write report to " << report_path << endl;
+            return 1;
+        }
+    }
+    ostream &report = report_path.empty() ? cout : report_file;
+    if (simulate)
+        manager.writeSimulationReport(report, result);
+    else
+        manager.writeSummaryReport(report);
+
+    if (!metrics_path.empty() && !manager.exportMetrics(metrics_path))
+    {
+        cerr << "Cannot write metrics to " << metrics_path << endl;
+        return 1;
+    }
+    if (!trace_path.empty() && !trace.writeFile(trace_path))
+    {
+        cerr << "Cannot write trace to " << trace_path << endl;
+        return 1;
+    }
+    if (events.isOpen())
+    {
+        if (!events.close())
+        {
+            cerr << "Event log write failed: " << events.getError() << " (" << events.getWrittenCount()
+                 << " records written)" << endl;
+            status = 1;
+        }
+        if (events.getDroppedCount() > 0)
+            cerr << "Event log: " << events.getDroppedCount() << " records dropped (ring buffer full)" << endl;
+    }
+    return status;
+}
+
 // Main entry point
-int main()
+int main(int argc, char *argv[])
 {
-    TaskManager manager;
-    manager.run();
-    return 0;
+    if (argc == 1)
+    {
+        TaskManager manager;
+        manager.run();
+        return 0;
+    }
+
+    string input, snapshot_in, snapshot_out, scheduler = "priority", report_path, log_path, metrics_path, trace_path, events_path, journal_path;
+    int workers = 1, budget_ms = 2000;
+    bool simulate = false;
+    for (int i = 1; i < argc; i++)
+    {
+        bool has_value = (i + 1 < argc);
+        if (strcmp(argv[i], "--batch") == 0 && has_value)
+            input = argv[++i];
+        else if (strcmp(argv[i], "--scheduler") == 0 && has_value)
+            scheduler = argv[++i];
+        else if (strcmp(argv[i], "--workers") == 0 && has_value)
+            workers = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--budget") == 0 && has_value)
+            budget_ms = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--report") == 0 && has_value)
+            report_path = argv[++i];
+        else if (strcmp(argv[i], "--log") == 0 && has_value)
+            log_path = argv[++i];
+        else if (strcmp(argv[i], "--metrics") == 0 && has_value)
+            metrics_path = argv[++i];
+        else if (strcmp(argv[i], "--trace") == 0 && has_value)
+            trace_path = argv[++i];
+        else if (strcmp(argv[i], "--events") == 0 && has_value)
+            events_path = argv[++i];
+        else if (strcmp(argv[i], "--load-snapshot") == 0 && has_value)
+            snapshot_in = argv[++i];
+        else if (strcmp(argv[i], "--save-snapshot") == 0 && has_value)
+            snapshot_out = argv[++i];
+        else if (strcmp(argv[i], "--simulate") == 0)
+            simulate = true;
+        else if (strcmp(argv[i], "--journal") == 0 && has_value)
+            journal_path = argv[++i];
+        else
+        {
+            printUsage(argv[0]);
+            return 2;
+        }
+    }
+
+    if (!journal_path.empty() && input.empty() && snapshot_in.empty())
+    {
+        TaskManager manager;
+        string error;
+        if (!manager.openJournal(journal_path, error))
+        {
+            cerr << "Cannot open journal " << journal_path << ": " << error << endl;
+            return 1;
+        }
+        manager.run();
+        return 0;
+    }
+    if (input.empty() == snapshot_in.empty())
+    {
+        printUsage(argv[0]);
+        return 2;
+    }
+    return runBatch(input, snapshot_in, snapshot_out, scheduler, workers, budget_ms, report_path, log_path, metrics_path, trace_path, events_path, journal_path, simulate);
 }
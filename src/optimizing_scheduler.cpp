@@ -0,0 +1,211 @@
+#include "optimizing_scheduler.h"
+#include "critical_path_scheduler.h"
+#include "simulator.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <thread>
+
+using namespace std;
+
+// Iterations between looks at the shared best order; a chain also syncs after
+// 1/SYNC_PER_BUDGET of the budget, for graphs where one evaluation is slow
+static const int SYNC_INTERVAL = 64;
+static const int SYNC_PER_BUDGET = 32;
+
+struct OptimizingScheduler::SearchState
+{
+    const vector<Task *> *start_order;
+    const Simulator *prepared;     // Holds the wait graph every thread simulates on
+    chrono::steady_clock::time_point start, deadline;
+    double initial_cost;
+
+    mutex lock;                    // Guards best_order and best_cost
+    vector<Task *> best_order;
+    double best_cost;
+    atomic<long long> evaluations;
+
+    SearchState() : start_order(nullptr), prepared(nullptr), initial_cost(0), best_cost(0), evaluations(0) {}
+};
+
+OptimizingScheduler::OptimizingScheduler(unique_ptr<Scheduler> seed, int workers, int budget_ms, int threads)
+    : seed_scheduler(move(seed)), worker_count(workers < 1 ? 1 : workers), budget_ms(budget_ms < 0 ? 0 : budget_ms),
+      thread_count(threads), tardiness_weight(1.0), random_seed(12345), initial_cost(0), best_cost(0), evaluations(0)
+{
+    if (!seed_scheduler)
+        seed_scheduler = make_unique<CriticalPathScheduler>();
+    if (thread_count < 1)
+        thread_count = max(1u, thread::hardware_concurrency());
+}
+
+double OptimizingScheduler::cost(long long makespan, long long total_lateness, size_t task_count) const
+{
+    return makespan + tardiness_weight * total_lateness / (task_count > 0 ? task_count : 1);
+}
+
+vector<Task *> OptimizingScheduler::schedule(const vector<Task *> &tasks)
+{
+    vector<Task *> order = seed_scheduler->schedule(tasks);
+    evaluations = 0;
+
+    // The wait graph is built once; every evaluation only reorders the same tasks
+    Simulator simulator(worker_count);
+    SimulationResult result;
+    simulator.prepare(order);
+    simulator.runPrepared(order, result, false);
+    initial_cost = best_cost = cost(result.makespan, result.total_lateness, order.size());
+    if (order.size() < 2 || budget_ms == 0)
+        return order;
+
+    SearchState state;
+    state.start_order = &order;
+    state.prepared = &simulator;
+    state.start = chrono::steady_clock::now();
+    state.deadline = state.start + chrono::milliseconds(budget_ms);
+    state.initial_cost = initial_cost;
+    state.best_order = order;
+    state.best_cost = initial_cost;
+
+    vector<thread> threads;
+    for (int t = 0; t < thread_count; t++)
+        threads.emplace_back(&OptimizingScheduler::searchLoop, this, ref(state), t);
+    for (thread &search : threads)
+        search.join();
+
+    best_cost = state.best_cost;
+    evaluations = state.evaluations.load() + 1;
+
+    // Replace the priority list by the order tasks actually started in, which
+    // respects every dependency and reproduces the same simulated schedule.
+    // Tasks the simulation never started (completed or blocked) keep their place at the end.
+    simulator.runPrepared(state.best_order, result, true);
+    vector<Task *> scheduled;
+    scheduled.reserve(order.size());
+    int max_id = 0;
+    for (Task *task : order)
+        max_id = max(max_id, task->getId());
+    vector<char> started(max_id + 1, 0);
+    for (const TaskTiming &timing : result.timings)
+    {
+        scheduled.push_back(timing.task);
+        started[timing.task->getId()] = 1;
+    }
+    for (Task *task : state.best_order)
+        if (!started[task->getId()])
+            scheduled.push_back(task);
+    return scheduled;
+}
+
+// One annealing chain. Moves are applied in place and undone when rejected.
+void OptimizingScheduler::searchLoop(SearchState &state, int thread_index)
+{
+    mt19937 rng(random_seed + thread_index * 7919);
+    Simulator simulator(worker_count);
+    simulator.shareGraph(*state.prepared);
+    SimulationResult result;
+    vector<Task *> order = *state.start_order;
+    size_t count = order.size();
+    uniform_int_distribution<size_t> any_position(0, count - 1);
+    uniform_real_distribution<double> unit(0.0, 1.0);
+
+    double current = state.initial_cost;
+    double best_seen = state.initial_cost; // Global best as of the last sync
+    // Start hot enough to accept a 1% worse order about a third of the time
+    double initial_temperature = max(1e-9, state.initial_cost * 0.01);
+    double total = chrono::duration<double>(state.deadline - state.start).count();
+    double temperature = initial_temperature;
+
+    auto sync_period = (state.deadline - state.start) / SYNC_PER_BUDGET;
+    auto next_sync = state.start;
+
+    for (long long iteration = 0;; iteration++)
+    {
+        // The clock is read before every evaluation: on a large graph a single
+        // simulation is expensive, so checking less often overshoots the budget
+        auto now = chrono::steady_clock::now();
+        if (now >= state.deadline)
+            break;
+        double progress = chrono::duration<double>(now - state.start).count() / total;
+        temperature = initial_temperature * pow(1e-4, progress);
+
+        if (iteration % SYNC_INTERVAL == 0 || now >= next_sync)
+        {
+            next_sync = now + sync_period;
+
+            // Restart from the global best when this chain has drifted away from it
+            lock_guard<mutex> guard(state.lock);
+            best_seen = state.best_cost;
+            if (state.best_cost < current && unit(rng) < 0.5)
+            {
+                order = state.best_order;
+                current = state.best_cost;
+            }
+        }
+
+        // Swap two tasks or move one task to another position (nearby half the time)
+        size_t i = any_position(rng), j;
+        bool swap_move = unit(rng) < 0.5;
+        if (unit(rng) < 0.5)
+        {
+            size_t window = max<size_t>(1, min<size_t>(count / 10, 64));
+            size_t offset = 1 + rng() % window;
+            j = (unit(rng) < 0.5) ? (i >= offset ? i - offset : 0) : min(count - 1, i + offset);
+        }
+        else
+            j = any_position(rng);
+        if (i == j)
+            continue;
+
+        if (swap_move)
+            swap(order[i], order[j]);
+        else if (i < j)
+            rotate(order.begin() + i, order.begin() + i + 1, order.begin() + j + 1);
+        else
+            rotate(order.begin() + j, order.begin() + i, order.begin() + i + 1);
+
+        simulator.runPrepared(order, result, false);
+        state.evaluations++;
+        double candidate = cost(result.makespan, result.total_lateness, count);
+        double delta = candidate - current;
+        if (delta <= 0 || unit(rng) < exp(-delta / temperature))
+        {
+            current = candidate;
+            if (candidate < best_seen)
+            {
+                lock_guard<mutex> guard(state.lock);
+                if (candidate < state.best_cost)
+                {
+                    state.best_cost = candidate;
+                    state.best_order = order;
+                }
+                best_seen = state.best_cost;
+            }
+            continue;
+        }
+
+        // Rejected: undo the move
+        if (swap_move)
+            swap(order[i], order[j]);
+        else if (i < j)
+            rotate(order.begin() + i, order.begin() + j, order.begin() + j + 1);
+        else
+            rotate(order.begin() + j, order.begin() + j + 1, order.begin() + i + 1);
+    }
+}
+
+string OptimizingScheduler::getName() const
+{
+    return "OptimizingScheduler(" + seed_scheduler->getName() + ")";
+}
+
+void OptimizingScheduler::setTardinessWeight(double weight) { tardiness_weight = weight; }
+
+void OptimizingScheduler::setRandomSeed(unsigned seed) { random_seed = seed; }
+
+double OptimizingScheduler::getInitialCost() const { return initial_cost; }
+
+double OptimizingScheduler::getBestCost() const { return best_cost; }
+
+long long OptimizingScheduler::getEvaluationCount() const { return evaluations; }
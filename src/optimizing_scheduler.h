@@ -0,0 +1,59 @@
+#ifndef OPTIMIZING_SCHEDULER_H
+#define OPTIMIZING_SCHEDULER_H
+
+#include "scheduler.h"
+#include <memory>
+#include <mutex>
+
+using namespace std;
+
+// OOP Concept: Inheritance - OptimizingScheduler inherits from Scheduler
+// OOP Concept: Composition - Wraps another Scheduler that provides the starting order
+// Spends a fixed time budget improving the wrapped scheduler's order with
+// simulated annealing over swap and insert moves. Every candidate is scored by
+// simulating it on the target number of workers (see simulator.h):
+//   cost = makespan + tardiness_weight * mean lateness
+// Each search thread runs its own annealing chain and periodically restarts from
+// the best order found by any thread. The result is the start order of the best
+// simulated run, which is always a valid dependency order.
+
+class OptimizingScheduler : public Scheduler
+{
+private:
+    unique_ptr<Scheduler> seed_scheduler;
+    int worker_count;     // Workers the schedule is optimized for
+    int budget_ms;        // Wall-clock search time
+    int thread_count;
+    double tardiness_weight;
+    unsigned random_seed;
+
+    // Best order found so far, shared between search threads
+    struct SearchState;
+    void searchLoop(SearchState &state, int thread_index);
+    double cost(long long makespan, long long total_lateness, size_t task_count) const;
+
+    // Statistics of the last schedule() call
+    double initial_cost, best_cost;
+    long long evaluations;
+
+public:
+    // seed: starting order (defaults to CriticalPathScheduler when null)
+    // threads: 0 uses one thread per hardware thread
+    OptimizingScheduler(unique_ptr<Scheduler> seed = nullptr, int workers = 1,
+                        int budget_ms = 2000, int threads = 0);
+
+    // OOP Concept: Polymorphism - Override pure virtual function
+    vector<Task *> schedule(const vector<Task *> &tasks) override;
+
+    string getName() const override;
+
+    void setTardinessWeight(double weight);
+    void setRandomSeed(unsigned seed);
+
+    // Results of the last schedule() call
+    double getInitialCost() const;
+    double getBestCost() const;
+    long long getEvaluationCount() const;
+};
+
+#endif // OPTIMIZING_SCHEDULER_H
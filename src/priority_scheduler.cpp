@@ -1,4 +1,5 @@
 #include "priority_scheduler.h"
+#include "config.h"
 #include <algorithm>
 
 using namespace std;
@@ -10,10 +11,40 @@ static bool comparePriority(const Task *a, const Task *b)
 }
 
 // Schedule tasks by priority (highest first)
+// Priorities are bounded (MIN_PRIORITY..MAX_PRIORITY), so a counting sort places
+// every task in O(n). It is stable: equal priorities keep their input order,
+// which is ID order for the task list built by TaskManager.
 vector<Task *> PriorityScheduler::schedule(const vector<Task *> &tasks)
+{
+    const int BUCKETS = MAX_PRIORITY - MIN_PRIORITY + 1;
+    int bucket_start[BUCKETS + 1] = {0};
+    vector<int> buckets(tasks.size());
+
+    // Pass 1: bucket index per task (highest priority -> bucket 0) and bucket sizes
+    for (size_t i = 0; i < tasks.size(); i++)
+    {
+        int priority = tasks[i]->getPriority();
+        if (priority < MIN_PRIORITY || priority > MAX_PRIORITY)
+            return scheduleByComparison(tasks);
+        buckets[i] = MAX_PRIORITY - priority;
+        bucket_start[buckets[i] + 1]++;
+    }
+
+    for (int b = 0; b < BUCKETS; b++)
+        bucket_start[b + 1] += bucket_start[b];
+
+    // Pass 2: place each task at the next free slot of its bucket
+    vector<Task *> scheduled(tasks.size());
+    for (size_t i = 0; i < tasks.size(); i++)
+        scheduled[bucket_start[buckets[i]]++] = tasks[i];
+    return scheduled;
+}
+
+// Fallback for priorities outside the configured range
+vector<Task *> PriorityScheduler::scheduleByComparison(const vector<Task *> &tasks)
 {
     vector<Task *> scheduled = tasks;
-    sort(scheduled.begin(), scheduled.end(), comparePriority);
+    stable_sort(scheduled.begin(), scheduled.end(), comparePriority);
     return scheduled;
 }
 
@@ -10,6 +10,10 @@ using namespace std;
 
 class PriorityScheduler : public Scheduler
 {
+private:
+    // Comparison sort used when a priority is outside MIN_PRIORITY..MAX_PRIORITY
+    vector<Task *> scheduleByComparison(const vector<Task *> &tasks);
+
 public:
     // OOP Concept: Polymorphism - Override pure virtual function
     vector<Task *> schedule(const vector<Task *> &tasks) override;
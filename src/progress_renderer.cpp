@@ -0,0 +1,161 @@
+#include "progress_renderer.h"
+#include "execution_metrics.h"
+#include "config.h"
+#include <chrono>
+
+using namespace std;
+
+// Constructor
+ProgressRenderer::ProgressRenderer(ostream &out)
+    : output(out), refresh_ms(33), running(false), stopping(false),
+      bar_open(false), bar_steps(0), bar_drawn(0), bar_start_ns(0), bar_duration_ns(0)
+{
+}
+
+ProgressRenderer::~ProgressRenderer()
+{
+    stop();
+}
+
+void ProgressRenderer::start()
+{
+    if (running)
+        return;
+    stopping = false;
+    running = true;
+    render_thread = thread(&ProgressRenderer::renderLoop, this);
+}
+
+void ProgressRenderer::stop()
+{
+    if (!running)
+        return;
+    {
+        lock_guard<mutex> lock(queue_mutex);
+        stopping = true;
+    }
+    wake.notify_one();
+    render_thread.join();
+    running = false;
+}
+
+bool ProgressRenderer::isRunning() const { return running; }
+
+void ProgressRenderer::setRefreshInterval(int ms) { refresh_ms = (ms < 1) ? 1 : ms; }
+
+void ProgressRenderer::post(RenderEvent &event)
+{
+    if (!running)
+        return;
+    event.time_ns = ExecutionMetrics::now();
+    lock_guard<mutex> lock(queue_mutex);
+    pending.push_back(move(event));
+}
+
+void ProgressRenderer::postText(const string &text)
+{
+    RenderEvent event = {TEXT, -1, 0, 0, 0, 0, 0, 0, 0, text};
+    post(event);
+}
+
+void ProgressRenderer::postTask(EventType type, const Task *task, int worker_id, int indent)
+{
+    RenderEvent event = {type, worker_id, indent, 0, task->getId(), task->getPriority(), task->getDeadline(), 0, 0, task->getName()};
+    post(event);
+}
+
+void ProgressRenderer::postProgressStart(int indent, int steps, uint64_t duration_ns)
+{
+    RenderEvent event = {PROGRESS_START, -1, indent, steps, 0, 0, 0, 0, duration_ns, string()};
+    post(event);
+}
+
+void ProgressRenderer::postProgressEnd()
+{
+    RenderEvent event = {PROGRESS_END, -1, 0, 0, 0, 0, 0, 0, 0, string()};
+    post(event);
+}
+
+// One frame per refresh interval: take the queued events, format them together,
+// then animate the open progress bar up to the current time
+void ProgressRenderer::renderLoop()
+{
+    vector<RenderEvent> batch;
+    string frame;
+    unique_lock<mutex> lock(queue_mutex);
+    while (true)
+    {
+        wake.wait_for(lock, chrono::milliseconds(refresh_ms));
+        batch.swap(pending);
+        bool finished = stopping;
+        lock.unlock();
+
+        frame.clear();
+        for (const RenderEvent &event : batch)
+            renderEvent(event, frame);
+        batch.clear();
+        if (bar_open)
+            advanceBar(frame, ExecutionMetrics::now(), false);
+        if (!frame.empty())
+        {
+            output.write(frame.data(), frame.size());
+            output.flush();
+        }
+
+        lock.lock();
+        if (finished && pending.empty())
+            break;
+    }
+}
+
+void ProgressRenderer::renderEvent(const RenderEvent &event, string &frame)
+{
+    if (event.type == TEXT)
+    {
+        frame += event.text;
+        return;
+    }
+    if (event.type == PROGRESS_START)
+    {
+        frame += "  " + string(event.indent * 2, ' ') + COLOR_CYAN + "    Progress: [";
+        bar_open = true;
+        bar_steps = event.steps;
+        bar_drawn = 0;
+        bar_start_ns = event.time_ns;
+        bar_duration_ns = event.duration_ns;
+        return;
+    }
+    if (event.type == PROGRESS_END)
+    {
+        if (bar_open)
+            advanceBar(frame, event.time_ns, true);
+        return;
+    }
+
+    bool is_running = (event.type == TASK_RUNNING);
+    frame += "  ";
+    if (event.worker >= 0)
+        frame += "[W" + to_string(event.worker) + "] ";
+    frame += string(event.indent * 2, ' ');
+    frame += is_running ? COLOR_BLUE "[~] RUNNING" : COLOR_GREEN "[+] COMPLETED";
+    frame += COLOR_RESET ": Task" + to_string(event.task_id) + " - " + event.text +
+             " (P=" + to_string(event.priority) + ", D=" + to_string(event.deadline) + "d)\n";
+}
+
+// Draw the bar in proportion to elapsed time; finish draws it to the end
+void ProgressRenderer::advanceBar(string &frame, uint64_t now_ns, bool finish)
+{
+    int target = bar_steps;
+    if (!finish && bar_duration_ns > 0 && now_ns - bar_start_ns < bar_duration_ns)
+        target = static_cast<int>(bar_steps * (now_ns - bar_start_ns) / bar_duration_ns);
+    if (target > bar_drawn)
+    {
+        frame.append(target - bar_drawn, '=');
+        bar_drawn = target;
+    }
+    if (finish)
+    {
+        frame += "] 100%" COLOR_RESET "\n";
+        bar_open = false;
+    }
+}
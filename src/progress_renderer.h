@@ -0,0 +1,89 @@
+#ifndef PROGRESS_RENDERER_H
+#define PROGRESS_RENDERER_H
+
+#include <vector>
+#include <string>
+#include <ostream>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <cstdint>
+#include "task.h"
+
+using namespace std;
+
+// OOP Concept: Encapsulation - Terminal output of a run, off the executing threads
+// Executors post small status events; one renderer thread wakes every refresh
+// interval, formats everything that arrived since the last frame and writes it
+// with a single write and flush. Progress bars are animated by the renderer from
+// the task's expected duration, so the executing thread never touches the stream.
+
+class ProgressRenderer
+{
+public:
+    enum EventType
+    {
+        TEXT,           // Preformatted text (banners, warnings)
+        TASK_RUNNING,
+        TASK_COMPLETED,
+        PROGRESS_START, // Open a progress bar that fills over duration_ns
+        PROGRESS_END    // Complete the open progress bar
+    };
+
+private:
+    struct RenderEvent
+    {
+        EventType type;
+        int worker;           // Shown as [W<n>] when >= 0
+        int indent;           // Subtask nesting level
+        int steps;            // Bar length for PROGRESS_START
+        int task_id;          // Task fields are copied at post time, so the
+        int priority;         // renderer never reads a Task another thread
+        int deadline;         // may be updating
+        uint64_t time_ns;     // When the event was posted
+        uint64_t duration_ns; // Expected bar duration for PROGRESS_START
+        string text;          // TEXT body, or the task name for task lines
+    };
+
+    ostream &output;
+    int refresh_ms;
+    bool running;
+
+    mutex queue_mutex;
+    condition_variable wake;
+    vector<RenderEvent> pending;
+    bool stopping;
+    thread render_thread;
+
+    // Progress bar being drawn (renderer thread only)
+    bool bar_open;
+    int bar_steps;
+    int bar_drawn;
+    uint64_t bar_start_ns;
+    uint64_t bar_duration_ns;
+
+    void post(RenderEvent &event);
+    void renderLoop();
+    void renderEvent(const RenderEvent &event, string &frame);
+    void advanceBar(string &frame, uint64_t now_ns, bool finish);
+
+public:
+    explicit ProgressRenderer(ostream &out);
+    ~ProgressRenderer();
+    ProgressRenderer(const ProgressRenderer &) = delete;
+    ProgressRenderer &operator=(const ProgressRenderer &) = delete;
+
+    // Start the renderer thread; events posted while stopped are dropped
+    void start();
+    // Render everything still queued, then stop the thread
+    void stop();
+    bool isRunning() const;
+    void setRefreshInterval(int ms);
+
+    void postText(const string &text);
+    void postTask(EventType type, const Task *task, int worker_id, int indent);
+    void postProgressStart(int indent, int steps, uint64_t duration_ns);
+    void postProgressEnd();
+};
+
+#endif // PROGRESS_RENDERER_H
@@ -0,0 +1,92 @@
+#include "read_snapshot.h"
+#include "task.h"
+
+using namespace std;
+
+// Constructor
+ReadSnapshot::ReadSnapshot(shared_ptr<const SnapshotStructure> shared_structure, vector<TaskStatus> task_statuses)
+    : structure(move(shared_structure)), statuses(move(task_statuses)), completed_count(0)
+{
+    for (TaskStatus status : statuses)
+        if (status == COMPLETED)
+            completed_count++;
+}
+
+// Columns are copied whole; subtask lists are flattened into one array
+shared_ptr<const SnapshotStructure> ReadSnapshot::buildStructure(const TaskStore &store, const deque<Task> &tasks,
+                                                                 unsigned long long graph_version,
+                                                                 const vector<int> &root_ids, long long total_descendants)
+{
+    shared_ptr<SnapshotStructure> built = make_shared<SnapshotStructure>();
+    built->graph_version = graph_version;
+    built->priorities = store.getPriorities();
+    built->deadlines = store.getDeadlines();
+    built->estimated_times = store.getEstimatedTimes();
+    built->name_indices = store.getNameIndices();
+    built->names = store.getNamePool();
+    built->root_ids = root_ids;
+    built->total_descendants = total_descendants;
+
+    built->subtask_offsets.resize(tasks.size() + 1);
+    size_t edges = 0;
+    for (size_t r = 0; r < tasks.size(); r++)
+    {
+        built->subtask_offsets[r] = edges;
+        edges += tasks[r].getSubtasks().size();
+    }
+    built->subtask_offsets[tasks.size()] = edges;
+    built->subtask_ids.reserve(edges);
+    for (const Task &task : tasks)
+        for (const Task *subtask : task.getSubtasks())
+            built->subtask_ids.push_back(subtask->getId());
+    return built;
+}
+
+const shared_ptr<const SnapshotStructure> &ReadSnapshot::getStructure() const { return structure; }
+
+unsigned long long ReadSnapshot::getGraphVersion() const { return structure->graph_version; }
+
+int ReadSnapshot::getTaskCount() const { return statuses.size(); }
+
+int ReadSnapshot::getCompletedCount() const { return completed_count; }
+
+int ReadSnapshot::getRootCount() const { return structure->root_ids.size(); }
+
+long long ReadSnapshot::getTotalDescendants() const { return structure->total_descendants; }
+
+const vector<int> &ReadSnapshot::getRootIds() const { return structure->root_ids; }
+
+const string &ReadSnapshot::getName(int id) const { return structure->names[structure->name_indices[id - 1]]; }
+
+int ReadSnapshot::getPriority(int id) const { return structure->priorities[id - 1]; }
+
+int ReadSnapshot::getDeadline(int id) const { return structure->deadlines[id - 1]; }
+
+int ReadSnapshot::getEstimatedTime(int id) const { return structure->estimated_times[id - 1]; }
+
+TaskStatus ReadSnapshot::getStatus(int id) const { return statuses[id - 1]; }
+
+const vector<int> &ReadSnapshot::getPriorities() const { return structure->priorities; }
+
+const vector<int> &ReadSnapshot::getDeadlines() const { return structure->deadlines; }
+
+const vector<int> &ReadSnapshot::getEstimatedTimes() const { return structure->estimated_times; }
+
+// Depth-first with an explicit stack; children are pushed in reverse so they
+// print in insertion order, as in the recursive Task version
+void ReadSnapshot::displayHierarchy(ostream &out) const
+{
+    vector<pair<int, int>> stack; // (task ID, indent)
+    for (int root : structure->root_ids)
+    {
+        stack.push_back(make_pair(root, 0));
+        while (!stack.empty())
+        {
+            int id = stack.back().first, indent = stack.back().second;
+            stack.pop_back();
+            Task::printInfoLine(out, id, getName(id), getPriority(id), getDeadline(id), getStatus(id), indent);
+            for (int e = structure->subtask_offsets[id]; e-- > structure->subtask_offsets[id - 1];)
+                stack.push_back(make_pair(structure->subtask_ids[e], indent + 1));
+        }
+    }
+}
@@ -0,0 +1,78 @@
+#ifndef READ_SNAPSHOT_H
+#define READ_SNAPSHOT_H
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <ostream>
+#include "task_store.h"
+
+using namespace std;
+
+class Task;
+
+// Everything about the graph except task status: properties, names and the
+// subtask hierarchy. Executors only change status, so one SnapshotStructure
+// is shared by every snapshot taken while the graph version stays the same.
+struct SnapshotStructure
+{
+    unsigned long long graph_version;
+    vector<int> priorities;   // By ID - 1
+    vector<int> deadlines;
+    vector<int> estimated_times;
+    vector<int> name_indices;
+    vector<string> names;     // Interned name pool
+    vector<int> subtask_offsets; // Subtask IDs of row r are subtask_ids[offsets[r] .. offsets[r + 1])
+    vector<int> subtask_ids;
+    vector<int> root_ids;     // Tasks that are nobody's subtask, in creation order
+    long long total_descendants;
+};
+
+// OOP Concept: Encapsulation - Immutable, self-contained view of the task graph
+// A snapshot never changes after it is built, so any number of threads can
+// read it without locks while executors keep updating the live tasks (see
+// SnapshotPublisher for how snapshots are published and reclaimed).
+
+class ReadSnapshot
+{
+private:
+    shared_ptr<const SnapshotStructure> structure;
+    vector<TaskStatus> statuses; // By ID - 1
+    int completed_count;
+
+public:
+    ReadSnapshot(shared_ptr<const SnapshotStructure> shared_structure, vector<TaskStatus> task_statuses);
+
+    // Copy the status-independent part of a graph; root_ids and
+    // total_descendants come from the TaskManager's hierarchy index
+    static shared_ptr<const SnapshotStructure> buildStructure(const TaskStore &store, const deque<Task> &tasks,
+                                                              unsigned long long graph_version,
+                                                              const vector<int> &root_ids, long long total_descendants);
+
+    const shared_ptr<const SnapshotStructure> &getStructure() const;
+    unsigned long long getGraphVersion() const;
+
+    int getTaskCount() const;
+    int getCompletedCount() const;
+    int getRootCount() const;
+    long long getTotalDescendants() const;
+    const vector<int> &getRootIds() const;
+
+    // Per-task values by ID (1 .. getTaskCount())
+    const string &getName(int id) const;
+    int getPriority(int id) const;
+    int getDeadline(int id) const;
+    int getEstimatedTime(int id) const;
+    TaskStatus getStatus(int id) const;
+
+    // Whole columns by ID - 1, for statistics
+    const vector<int> &getPriorities() const;
+    const vector<int> &getDeadlines() const;
+    const vector<int> &getEstimatedTimes() const;
+
+    // Same output as Task::displayHierarchy for every root task
+    void displayHierarchy(ostream &out) const;
+};
+
+#endif // READ_SNAPSHOT_H
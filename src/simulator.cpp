@@ -0,0 +1,203 @@
+#include "simulator.h"
+#include "cycle_finder.h"
+#include <queue>
+#include <functional>
+#include <algorithm>
+
+using namespace std;
+
+double SimulationResult::utilization(int workers) const
+{
+    if (makespan == 0 || workers < 1)
+        return 0.0;
+    return static_cast<double>(total_work) / (static_cast<double>(makespan) * workers);
+}
+
+Simulator::Simulator(int workers) : worker_count(workers < 1 ? 1 : workers)
+{
+}
+
+void Simulator::setWorkerCount(int workers) { worker_count = (workers < 1) ? 1 : workers; }
+
+int Simulator::getWorkerCount() const { return worker_count; }
+
+// Index tasks by node and collect reverse wait edges
+// A dependency or subtask outside the list that is not COMPLETED is never satisfied
+void Simulator::prepare(const vector<Task *> &tasks)
+{
+    shared_ptr<SimulationGraph> built = make_shared<SimulationGraph>();
+    SimulationGraph &g = *built;
+    size_t count = tasks.size();
+    int max_id = 0;
+    for (Task *task : tasks)
+        max_id = max(max_id, task->getId());
+    g.tasks = tasks;
+    g.node_of_id.assign(max_id + 1, -1);
+    g.durations.resize(count);
+    g.deadlines.resize(count);
+    g.done.resize(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        Task *task = tasks[i];
+        g.node_of_id[task->getId()] = i;
+        g.durations[i] = task->getEstimatedTime();
+        g.deadlines[i] = task->getDeadline();
+        g.done[i] = (task->getStatus() == COMPLETED);
+    }
+
+    // One pass over the dependency lists; edges are then bucketed by dependency
+    g.unmet.assign(count, 0);
+    g.dependent_offsets.assign(count + 1, 0);
+    vector<int> edge_from, edge_to;
+    edge_from.reserve(count);
+    edge_to.reserve(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        // A completed task waits for nothing and must not be released again,
+        // the same rule findSubtaskGates applies to subtasks
+        if (g.done[i])
+            continue;
+        for (Task *dep : tasks[i]->getDependencies())
+        {
+            int id = dep->getId();
+            int node = (id <= max_id) ? g.node_of_id[id] : -1;
+            if (node < 0)
+            {
+                if (dep->getStatus() != COMPLETED)
+                    g.unmet[i]++;
+                continue;
+            }
+            if (g.done[node])
+                continue;
+            g.unmet[i]++;
+            edge_from.push_back(node);
+            edge_to.push_back(i);
+            g.dependent_offsets[node + 1]++;
+        }
+
+        // A subtask outside the list that is not COMPLETED never finishes
+        for (Task *subtask : tasks[i]->getSubtasks())
+        {
+            int id = subtask->getId();
+            if ((id > max_id || g.node_of_id[id] < 0) && subtask->getStatus() != COMPLETED)
+                g.unmet[i]++;
+        }
+    }
+
+    // A parent waits for its subtasks, as in TaskExecutor's parallel mode
+    for (const pair<int, int> &gate : CycleFinder::findSubtaskGates(tasks))
+    {
+        g.unmet[gate.second]++;
+        edge_from.push_back(gate.first);
+        edge_to.push_back(gate.second);
+        g.dependent_offsets[gate.first + 1]++;
+    }
+
+    for (size_t i = 0; i < count; i++)
+        g.dependent_offsets[i + 1] += g.dependent_offsets[i];
+    g.dependents.resize(edge_from.size());
+    vector<int> fill(g.dependent_offsets.begin(), g.dependent_offsets.end() - 1);
+    for (size_t e = 0; e < edge_from.size(); e++)
+        g.dependents[fill[edge_from[e]]++] = edge_to[e];
+
+    graph = built;
+}
+
+void Simulator::shareGraph(const Simulator &other) { graph = other.graph; }
+
+void Simulator::run(const vector<Task *> &ordered_tasks, SimulationResult &result, bool record_timings)
+{
+    prepare(ordered_tasks);
+    runPrepared(ordered_tasks, result, record_timings);
+}
+
+void Simulator::runPrepared(const vector<Task *> &ordered_tasks, SimulationResult &result, bool record_timings)
+{
+    result.makespan = 0;
+    result.total_work = 0;
+    result.late_count = 0;
+    result.total_lateness = 0;
+    result.max_lateness = 0;
+    result.blocked_count = 0;
+    result.timings.clear();
+
+    const SimulationGraph &g = *graph;
+    size_t count = ordered_tasks.size();
+    node_at_rank.resize(count);
+    rank_of_node.resize(count);
+    for (size_t rank = 0; rank < count; rank++)
+    {
+        int node = g.node_of_id[ordered_tasks[rank]->getId()];
+        node_at_rank[rank] = node;
+        rank_of_node[node] = rank;
+    }
+    unmet = g.unmet;
+
+    // Ready tasks by position in the order, lowest first
+    priority_queue<int, vector<int>, greater<int>> ready;
+    // Completion events: (finish time, node), earliest first
+    typedef pair<long long, int> Event;
+    priority_queue<Event, vector<Event>, greater<Event>> events;
+    worker_of.resize(count);
+    if (record_timings)
+        result.timings.reserve(count);
+    vector<int> idle_workers;
+    for (int w = worker_count; w >= 1; w--)
+        idle_workers.push_back(w);
+
+    size_t simulated = 0;
+    for (size_t rank = 0; rank < count; rank++)
+    {
+        int node = node_at_rank[rank];
+        if (g.done[node])
+            simulated++; // Already done, never scheduled
+        else if (unmet[node] == 0)
+            ready.push(rank);
+    }
+
+    long long now = 0;
+    while (!ready.empty() || !events.empty())
+    {
+        // Hand ready tasks to idle workers at the current time
+        while (!ready.empty() && !idle_workers.empty())
+        {
+            int node = node_at_rank[ready.top()];
+            ready.pop();
+            int worker = idle_workers.back();
+            idle_workers.pop_back();
+            long long finish = now + g.durations[node];
+            events.push(Event(finish, node));
+            worker_of[node] = worker;
+            if (record_timings)
+            {
+                TaskTiming timing = {g.tasks[node], worker, now, finish, max(0LL, finish - g.deadlines[node])};
+                result.timings.push_back(timing);
+            }
+        }
+
+        // Advance the clock to the next completion and retire every task finishing then
+        now = events.top().first;
+        while (!events.empty() && events.top().first == now)
+        {
+            int node = events.top().second;
+            events.pop();
+            simulated++;
+            result.total_work += g.durations[node];
+            long long lateness = max(0LL, now - g.deadlines[node]);
+            if (lateness > 0)
+            {
+                result.late_count++;
+                result.total_lateness += lateness;
+                result.max_lateness = max(result.max_lateness, lateness);
+            }
+            idle_workers.push_back(worker_of[node]);
+
+            for (int e = g.dependent_offsets[node]; e < g.dependent_offsets[node + 1]; e++)
+                if (--unmet[g.dependents[e]] == 0)
+                    ready.push(rank_of_node[g.dependents[e]]);
+        }
+    }
+
+    result.makespan = now;
+    result.blocked_count = count - simulated;
+}
@@ -0,0 +1,88 @@
+#ifndef SIMULATOR_H
+#define SIMULATOR_H
+
+#include <vector>
+#include <memory>
+#include "task.h"
+
+using namespace std;
+
+// Virtual start/finish of one simulated task
+struct TaskTiming
+{
+    Task *task;
+    int worker;
+    long long start;
+    long long finish;
+    long long lateness; // finish - deadline, 0 if on time
+};
+
+// Outcome of one simulated run
+struct SimulationResult
+{
+    long long makespan;       // Virtual time when the last task finishes
+    long long total_work;     // Sum of estimated times of simulated tasks
+    int late_count;           // Tasks finishing after their deadline
+    long long total_lateness;
+    long long max_lateness;
+    int blocked_count;        // Tasks whose dependencies never complete
+    vector<TaskTiming> timings; // In order of start time
+
+    double utilization(int workers) const;
+};
+
+// Wait graph of one task set, by node (position in the list given to
+// Simulator::prepare). Never changed once built, so it can be shared
+struct SimulationGraph
+{
+    vector<Task *> tasks;        // Node -> task
+    vector<int> node_of_id;      // Task ID -> node, -1 if absent
+    vector<int> durations, deadlines; // Copied per node so the event loop stays sequential
+    vector<char> done;           // Task already COMPLETED before the simulation
+    vector<int> unmet;           // Unfinished dependencies and subtasks per node
+    vector<int> dependent_offsets, dependents; // Reverse wait edges (CSR): dependency -> dependent, subtask -> parent
+};
+
+// OOP Concept: Encapsulation - Discrete-event simulation of TaskExecutor
+// Plays a schedule on P virtual workers with an event queue keyed on virtual
+// time instead of sleeping. Like the executor in parallel mode, a task becomes
+// ready when its dependencies and its subtasks have finished (see
+// CycleFinder::findSubtaskGates), and idle workers take the earliest-scheduled
+// ready task. One estimated time unit equals one deadline day, starting at time 0.
+// Task status is never changed; tasks that are already COMPLETED count as
+// finished at time 0 and are not simulated.
+class Simulator
+{
+private:
+    int worker_count;
+    shared_ptr<const SimulationGraph> graph; // Set by prepare() or shareGraph()
+
+    // Scratch buffers, kept between runs to avoid reallocation
+    vector<int> node_at_rank;    // Position in the simulated order -> node
+    vector<int> rank_of_node;    // Node -> position in the simulated order
+    vector<int> unmet;           // Counts down from graph->unmet during a run
+    vector<int> worker_of;
+
+public:
+    explicit Simulator(int workers = 1);
+
+    void setWorkerCount(int workers);
+    int getWorkerCount() const;
+
+    // Build the wait graph of tasks; runPrepared() then simulates any order of
+    // the same tasks without rebuilding it
+    void prepare(const vector<Task *> &tasks);
+
+    // Use the graph another simulator prepared (read-only, so simulators on
+    // different threads can share one)
+    void shareGraph(const Simulator &other);
+
+    // Simulate ordered_tasks, overwriting result (prepares the graph first)
+    // record_timings = false skips the per-task list (for repeated evaluation)
+    void run(const vector<Task *> &ordered_tasks, SimulationResult &result, bool record_timings = true);
+
+    // Same, for an order of exactly the tasks passed to prepare()
+    void runPrepared(const vector<Task *> &ordered_tasks, SimulationResult &result, bool record_timings = true);
+};
+
+#endif // SIMULATOR_H
@@ -0,0 +1,347 @@
+#include "snapshot.h"
+#include <cstdio>
+#include <cstring>
+#ifdef _WIN32
+#include <io.h>
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+// Round a byte count up to the next 8-byte boundary
+static uint64_t align8(uint64_t bytes)
+{
+    return (bytes + 7) & ~uint64_t(7);
+}
+
+// Write one section followed by zero padding
+static bool writeSection(FILE *file, const void *data, uint64_t bytes)
+{
+    static const char padding[8] = {0};
+    if (bytes > 0 && fwrite(data, 1, bytes, file) != bytes)
+        return false;
+    uint64_t pad = align8(bytes) - bytes;
+    return pad == 0 || fwrite(padding, 1, pad, file) == pad;
+}
+
+// ========== WRITER ==========
+
+bool SnapshotWriter::write(const string &path, const TaskStore &store,
+                           const EdgeList &subtasks, const EdgeList &dependencies,
+                           uint32_t generation)
+{
+    size_t rows = store.size();
+    const vector<string> &names = store.getNamePool();
+
+    vector<uint64_t> name_offsets(1, 0);
+    name_offsets.reserve(names.size() + 1);
+    string name_data;
+    for (const string &name : names)
+    {
+        name_data += name;
+        name_offsets.push_back(name_data.size());
+    }
+
+    SnapshotHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, SNAPSHOT_MAGIC, 8);
+    header.version = SNAPSHOT_VERSION;
+    header.generation = generation;
+    header.task_count = rows;
+    header.name_count = names.size();
+    header.name_bytes = name_data.size();
+    header.subtask_count = subtasks.targets.size();
+    header.dependency_count = dependencies.targets.size();
+
+    // Status is an enum in memory, stored as int32 on disk
+    vector<int32_t> statuses(store.getStatuses().begin(), store.getStatuses().end());
+
+    FILE *file = fopen(path.c_str(), "wb");
+    if (file == nullptr)
+        return false;
+
+    uint64_t column_bytes = rows * sizeof(int32_t);
+    bool ok = writeSection(file, &header, sizeof(header)) &&
+              writeSection(file, store.getPriorities().data(), column_bytes) &&
+              writeSection(file, store.getDeadlines().data(), column_bytes) &&
+              writeSection(file, statuses.data(), column_bytes) &&
+              writeSection(file, store.getEstimatedTimes().data(), column_bytes) &&
+              writeSection(file, store.getNameIndices().data(), column_bytes) &&
+              writeSection(file, name_offsets.data(), name_offsets.size() * sizeof(uint64_t)) &&
+              writeSection(file, name_data.data(), name_data.size()) &&
+              writeSection(file, subtasks.offsets.data(), subtasks.offsets.size() * sizeof(uint64_t)) &&
+              writeSection(file, subtasks.targets.data(), subtasks.targets.size() * sizeof(int32_t)) &&
+              writeSection(file, dependencies.offsets.data(), dependencies.offsets.size() * sizeof(uint64_t)) &&
+              writeSection(file, dependencies.targets.data(), dependencies.targets.size() * sizeof(int32_t));
+
+    // Make the snapshot durable before a caller renames it into place
+    ok = ok && fflush(file) == 0;
+#ifdef _WIN32
+    ok = ok && _commit(_fileno(file)) == 0;
+#else
+    ok = ok && fsync(fileno(file)) == 0;
+#endif
+    return (fclose(file) == 0) && ok;
+}
+
+// ========== MAPPED READER ==========
+
+SnapshotFile::SnapshotFile()
+    : data(nullptr), size(0),
+#ifdef _WIN32
+      file_handle(INVALID_HANDLE_VALUE), mapping_handle(nullptr),
+#else
+      file_descriptor(-1),
+#endif
+      name_offsets(nullptr), name_data(nullptr), subtask_offsets(nullptr),
+      dependency_offsets(nullptr), subtask_targets(nullptr), dependency_targets(nullptr)
+{
+    memset(&header, 0, sizeof(header));
+    memset(columns, 0, sizeof(columns));
+}
+
+SnapshotFile::~SnapshotFile()
+{
+    unmapFile();
+}
+
+// Map the whole file read-only
+bool SnapshotFile::mapFile(const string &path)
+{
+#ifdef _WIN32
+    file_handle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file_handle == INVALID_HANDLE_VALUE)
+        return false;
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file_handle, &file_size) || file_size.QuadPart == 0)
+        return false;
+    size = file_size.QuadPart;
+    mapping_handle = CreateFileMappingA(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping_handle == nullptr)
+        return false;
+    data = static_cast<const char *>(MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0));
+#else
+    file_descriptor = ::open(path.c_str(), O_RDONLY);
+    if (file_descriptor < 0)
+        return false;
+    struct stat info;
+    if (fstat(file_descriptor, &info) != 0 || info.st_size == 0)
+        return false;
+    size = info.st_size;
+    void *mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    data = (mapped == MAP_FAILED) ? nullptr : static_cast<const char *>(mapped);
+#endif
+    return data != nullptr;
+}
+
+void SnapshotFile::unmapFile()
+{
+#ifdef _WIN32
+    if (data != nullptr)
+        UnmapViewOfFile(data);
+    if (mapping_handle != nullptr)
+        CloseHandle(mapping_handle);
+    if (file_handle != INVALID_HANDLE_VALUE)
+        CloseHandle(file_handle);
+    mapping_handle = nullptr;
+    file_handle = INVALID_HANDLE_VALUE;
+#else
+    if (data != nullptr)
+        munmap(const_cast<char *>(data), size);
+    if (file_descriptor >= 0)
+        close(file_descriptor);
+    file_descriptor = -1;
+#endif
+    data = nullptr;
+    size = 0;
+}
+
+// Check the header, locate every section and verify the CSR edge lists
+bool SnapshotFile::validate(string &error)
+{
+    if (size < sizeof(SnapshotHeader))
+    {
+        error = "file too small";
+        return false;
+    }
+    memcpy(&header, data, sizeof(header));
+    if (memcmp(header.magic, SNAPSHOT_MAGIC, 8) != 0)
+    {
+        error = "not a task snapshot";
+        return false;
+    }
+    if (header.version != SNAPSHOT_VERSION)
+    {
+        error = "unsupported snapshot version " + to_string(header.version);
+        return false;
+    }
+
+    // Every count is bounded by the file size; this also rules out overflow below
+    uint64_t rows = header.task_count;
+    if (rows > size || header.name_count > size || header.name_bytes > size ||
+        header.subtask_count > size || header.dependency_count > size)
+    {
+        error = "file size does not match header";
+        return false;
+    }
+    uint64_t section_sizes[12] = {
+        sizeof(SnapshotHeader),
+        rows * 4, rows * 4, rows * 4, rows * 4, rows * 4,
+        (header.name_count + 1) * 8, header.name_bytes,
+        (rows + 1) * 8, header.subtask_count * 4,
+        (rows + 1) * 8, header.dependency_count * 4};
+    const char *sections[12];
+    uint64_t offset = 0;
+    for (int i = 0; i < 12; i++)
+    {
+        sections[i] = data + offset;
+        offset += align8(section_sizes[i]);
+    }
+    if (offset != size)
+    {
+        error = "file size does not match header";
+        return false;
+    }
+
+    for (int c = 0; c < 5; c++)
+        columns[c] = reinterpret_cast<const int32_t *>(sections[1 + c]);
+    name_offsets = reinterpret_cast<const uint64_t *>(sections[6]);
+    name_data = sections[7];
+    subtask_offsets = reinterpret_cast<const uint64_t *>(sections[8]);
+    subtask_targets = reinterpret_cast<const int32_t *>(sections[9]);
+    dependency_offsets = reinterpret_cast<const uint64_t *>(sections[10]);
+    dependency_targets = reinterpret_cast<const int32_t *>(sections[11]);
+
+    // Offsets must be non-decreasing and end at the section size; indices and
+    // statuses must be in range
+    if (name_offsets[0] != 0 || name_offsets[header.name_count] != header.name_bytes ||
+        subtask_offsets[0] != 0 || subtask_offsets[rows] != header.subtask_count ||
+        dependency_offsets[0] != 0 || dependency_offsets[rows] != header.dependency_count)
+    {
+        error = "corrupt offsets";
+        return false;
+    }
+    for (uint64_t i = 0; i < header.name_count; i++)
+    {
+        if (name_offsets[i] > name_offsets[i + 1])
+        {
+            error = "corrupt name table";
+            return false;
+        }
+    }
+    for (uint64_t r = 0; r < rows; r++)
+    {
+        if (subtask_offsets[r] > subtask_offsets[r + 1] || dependency_offsets[r] > dependency_offsets[r + 1] ||
+            columns[2][r] < PENDING || columns[2][r] > COMPLETED ||
+            columns[4][r] < 0 || (uint64_t)columns[4][r] >= header.name_count)
+        {
+            error = "corrupt task row " + to_string(r);
+            return false;
+        }
+    }
+    for (uint64_t e = 0; e < header.subtask_count; e++)
+    {
+        if (subtask_targets[e] < 0 || (uint64_t)subtask_targets[e] >= rows)
+        {
+            error = "subtask edge out of range";
+            return false;
+        }
+    }
+    for (uint64_t e = 0; e < header.dependency_count; e++)
+    {
+        if (dependency_targets[e] < 0 || (uint64_t)dependency_targets[e] >= rows)
+        {
+            error = "dependency edge out of range";
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SnapshotFile::open(const string &path, string &error)
+{
+    unmapFile();
+    if (!mapFile(path))
+    {
+        unmapFile();
+        error = "cannot map " + path;
+        return false;
+    }
+    if (!validate(error))
+    {
+        unmapFile();
+        return false;
+    }
+    return true;
+}
+
+size_t SnapshotFile::getTaskCount() const
+{
+    return header.task_count;
+}
+
+size_t SnapshotFile::getNameCount() const
+{
+    return header.name_count;
+}
+
+uint32_t SnapshotFile::getGeneration() const
+{
+    return header.generation;
+}
+
+const int32_t *SnapshotFile::getPriorities() const
+{
+    return columns[0];
+}
+
+const int32_t *SnapshotFile::getDeadlines() const
+{
+    return columns[1];
+}
+
+const int32_t *SnapshotFile::getStatuses() const
+{
+    return columns[2];
+}
+
+const int32_t *SnapshotFile::getEstimatedTimes() const
+{
+    return columns[3];
+}
+
+const int32_t *SnapshotFile::getNameIndices() const
+{
+    return columns[4];
+}
+
+string SnapshotFile::getName(size_t index) const
+{
+    return string(name_data + name_offsets[index], name_offsets[index + 1] - name_offsets[index]);
+}
+
+const uint64_t *SnapshotFile::getSubtaskOffsets() const
+{
+    return subtask_offsets;
+}
+
+const int32_t *SnapshotFile::getSubtaskTargets() const
+{
+    return subtask_targets;
+}
+
+const uint64_t *SnapshotFile::getDependencyOffsets() const
+{
+    return dependency_offsets;
+}
+
+const int32_t *SnapshotFile::getDependencyTargets() const
+{
+    return dependency_targets;
+}
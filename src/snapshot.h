@@ -0,0 +1,111 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "task_store.h"
+
+using namespace std;
+
+// Binary task graph snapshot (version 1)
+//
+// Layout (native little-endian, every section starts on an 8-byte boundary):
+//   SnapshotHeader
+//   int32  priorities[task_count]
+//   int32  deadlines[task_count]
+//   int32  statuses[task_count]
+//   int32  estimated_times[task_count]
+//   int32  name_indices[task_count]
+//   uint64 name_offsets[name_count + 1]     Start of each name in name_data
+//   char   name_data[name_bytes]
+//   uint64 subtask_offsets[task_count + 1]  CSR: edges of row r are
+//   int32  subtask_targets[subtask_count]   targets[offsets[r] .. offsets[r + 1])
+//   uint64 dependency_offsets[task_count + 1]
+//   int32  dependency_targets[dependency_count]
+//
+// Rows are task IDs - 1, edge targets are rows.
+
+#define SNAPSHOT_MAGIC "HTSESNAP"
+#define SNAPSHOT_VERSION 1
+
+struct SnapshotHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t generation; // Journal generation this snapshot belongs to (see journal.h)
+    uint64_t task_count;
+    uint64_t name_count;
+    uint64_t name_bytes;
+    uint64_t subtask_count;
+    uint64_t dependency_count;
+};
+
+// Compressed sparse row edge list, one block of targets per task row
+struct EdgeList
+{
+    vector<uint64_t> offsets;
+    vector<int32_t> targets;
+};
+
+// Writes a snapshot file from in-memory columns and edge lists
+class SnapshotWriter
+{
+public:
+    static bool write(const string &path, const TaskStore &store,
+                      const EdgeList &subtasks, const EdgeList &dependencies,
+                      uint32_t generation = 0);
+};
+
+// OOP Concept: Encapsulation - Read-only, memory-mapped view of a snapshot file
+// Opening only maps the file and checks its structure; the column arrays are
+// then used in place without parsing.
+class SnapshotFile
+{
+private:
+    const char *data;
+    size_t size;
+#ifdef _WIN32
+    void *file_handle;
+    void *mapping_handle;
+#else
+    int file_descriptor;
+#endif
+    SnapshotHeader header;
+    const int32_t *columns[5];
+    const uint64_t *name_offsets;
+    const char *name_data;
+    const uint64_t *subtask_offsets, *dependency_offsets;
+    const int32_t *subtask_targets, *dependency_targets;
+
+    bool mapFile(const string &path);
+    void unmapFile();
+    bool validate(string &error);
+
+public:
+    SnapshotFile();
+    ~SnapshotFile();
+    SnapshotFile(const SnapshotFile &) = delete;
+    SnapshotFile &operator=(const SnapshotFile &) = delete;
+
+    // Map and check a snapshot, returns false with a message on failure
+    bool open(const string &path, string &error);
+
+    size_t getTaskCount() const;
+    size_t getNameCount() const;
+    uint32_t getGeneration() const;
+    const int32_t *getPriorities() const;
+    const int32_t *getDeadlines() const;
+    const int32_t *getStatuses() const;
+    const int32_t *getEstimatedTimes() const;
+    const int32_t *getNameIndices() const;
+    string getName(size_t index) const;
+
+    // CSR edge access
+    const uint64_t *getSubtaskOffsets() const;
+    const int32_t *getSubtaskTargets() const;
+    const uint64_t *getDependencyOffsets() const;
+    const int32_t *getDependencyTargets() const;
+};
+
+#endif // SNAPSHOT_H
@@ -0,0 +1,130 @@
+#include "snapshot_publisher.h"
+#include "task.h"
+#include <chrono>
+
+using namespace std;
+
+static uint64_t nowNs()
+{
+    return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// ========== READER ==========
+
+// Pin first, then load: the snapshot cannot be freed until the pin is dropped
+SnapshotPublisher::Reader::Reader(SnapshotPublisher &source)
+    : publisher(source), slot(source.epochs.enter()), snapshot(source.current.load())
+{
+    if (publisher.running.load(memory_order_relaxed))
+        publisher.requested.store(true, memory_order_relaxed);
+}
+
+SnapshotPublisher::Reader::~Reader()
+{
+    publisher.epochs.exit(slot);
+}
+
+bool SnapshotPublisher::Reader::valid() const { return snapshot != nullptr; }
+
+const ReadSnapshot &SnapshotPublisher::Reader::operator*() const { return *snapshot; }
+
+const ReadSnapshot *SnapshotPublisher::Reader::operator->() const { return snapshot; }
+
+// ========== PUBLISHER ==========
+
+// Constructor
+SnapshotPublisher::SnapshotPublisher()
+    : current(nullptr), live_count(0), running(false), requested(false), publishing(false),
+      last_publish_ns(0), refresh_interval_ns(20000000)
+{
+}
+
+// Destructor - no Reader may outlive the publisher
+SnapshotPublisher::~SnapshotPublisher()
+{
+    delete current.load();
+}
+
+void SnapshotPublisher::replace(const ReadSnapshot *snapshot)
+{
+    const ReadSnapshot *old = current.exchange(snapshot);
+    if (old)
+        epochs.retire(old);
+    last_publish_ns.store(nowNs(), memory_order_relaxed);
+}
+
+void SnapshotPublisher::publish(shared_ptr<const SnapshotStructure> structure, vector<TaskStatus> statuses)
+{
+    replace(new ReadSnapshot(move(structure), move(statuses)));
+}
+
+// The mirror is filled before any worker starts, so workers only ever store
+// into it and copy out of it
+void SnapshotPublisher::beginRun(shared_ptr<const SnapshotStructure> structure, const vector<TaskStatus> &statuses)
+{
+    if (live_count != statuses.size())
+    {
+        live_statuses.reset(new atomic<uint8_t>[statuses.size()]);
+        live_count = statuses.size();
+    }
+    for (size_t i = 0; i < live_count; i++)
+        live_statuses[i].store(statuses[i], memory_order_relaxed);
+    run_structure = structure;
+    publish(move(structure), statuses);
+    requested.store(false, memory_order_relaxed);
+    running.store(true);
+}
+
+void SnapshotPublisher::endRun()
+{
+    running.store(false);
+    run_structure.reset();
+}
+
+shared_ptr<const SnapshotStructure> SnapshotPublisher::getCurrentStructure()
+{
+    Reader reader(*this);
+    return reader.valid() ? reader->getStructure() : nullptr;
+}
+
+void SnapshotPublisher::setRefreshInterval(int ms) { refresh_interval_ns = (uint64_t)ms * 1000000; }
+
+void SnapshotPublisher::updateLive(Task *task, TaskStatus status)
+{
+    if (!running.load(memory_order_relaxed))
+        return;
+    size_t row = task->getId() - 1;
+    if (row < live_count)
+        live_statuses[row].store(status, memory_order_relaxed);
+    if (requested.load(memory_order_relaxed))
+        publishLive();
+}
+
+// Only one worker builds at a time; the others skip instead of waiting
+void SnapshotPublisher::publishLive()
+{
+    uint64_t now = nowNs();
+    if (now - last_publish_ns.load(memory_order_relaxed) < refresh_interval_ns)
+        return;
+    bool idle = false;
+    if (!publishing.compare_exchange_strong(idle, true, memory_order_acquire))
+        return;
+    requested.store(false, memory_order_relaxed);
+    vector<TaskStatus> statuses(live_count);
+    for (size_t i = 0; i < live_count; i++)
+        statuses[i] = (TaskStatus)live_statuses[i].load(memory_order_relaxed);
+    replace(new ReadSnapshot(run_structure, move(statuses)));
+    publishing.store(false, memory_order_release);
+}
+
+void SnapshotPublisher::onTaskStarted(Task *task, int worker_id)
+{
+    (void)worker_id;
+    updateLive(task, RUNNING);
+}
+
+void SnapshotPublisher::onTaskCompleted(Task *task, int worker_id)
+{
+    (void)worker_id;
+    updateLive(task, COMPLETED);
+}
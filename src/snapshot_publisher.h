@@ -0,0 +1,86 @@
+#ifndef SNAPSHOT_PUBLISHER_H
+#define SNAPSHOT_PUBLISHER_H
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include "execution_listener.h"
+#include "epoch_reclaimer.h"
+#include "read_snapshot.h"
+
+using namespace std;
+
+// OOP Concept: Inheritance - An ExecutionListener that keeps a ReadSnapshot
+// of the graph current while tasks run
+//
+// The current snapshot is one atomic pointer. Readers pin an epoch, load the
+// pointer and read the snapshot for as long as their Reader lives; replaced
+// snapshots are freed through the EpochReclaimer once no reader can hold them.
+// Between runs the owner publishes with publish(). During a run the worker
+// threads mirror every status change into an array of atomics. Once a reader
+// has asked for a view, the first task start or finish after the refresh
+// interval publishes a new snapshot (reusing the structure of the run). The
+// publishing worker takes a try-lock, so workers never wait on each other or
+// on readers, and nothing is copied while nobody reads.
+
+class SnapshotPublisher : public ExecutionListener
+{
+private:
+    EpochReclaimer epochs;
+    atomic<const ReadSnapshot *> current;
+
+    // Run in progress: structure and live status mirror (set before workers start)
+    shared_ptr<const SnapshotStructure> run_structure;
+    unique_ptr<atomic<uint8_t>[]> live_statuses;
+    size_t live_count;
+    atomic<bool> running;
+    atomic<bool> requested;  // A reader wants a fresher snapshot
+    atomic<bool> publishing; // Try-lock held by the worker building a snapshot
+    atomic<uint64_t> last_publish_ns;
+    uint64_t refresh_interval_ns;
+
+    void replace(const ReadSnapshot *snapshot);
+    void updateLive(Task *task, TaskStatus status);
+    void publishLive();
+
+public:
+    // OOP Concept: Encapsulation - RAII read access to the current snapshot
+    // Keep Readers short-lived: a Reader held forever stops reclamation
+    class Reader
+    {
+    private:
+        SnapshotPublisher &publisher;
+        int slot;
+        const ReadSnapshot *snapshot;
+
+    public:
+        explicit Reader(SnapshotPublisher &source);
+        ~Reader();
+        Reader(const Reader &) = delete;
+        Reader &operator=(const Reader &) = delete;
+
+        bool valid() const; // False until something was published
+        const ReadSnapshot &operator*() const;
+        const ReadSnapshot *operator->() const;
+    };
+
+    SnapshotPublisher();
+    ~SnapshotPublisher();
+
+    // Owner thread, no run in progress: make snapshot the current one
+    void publish(shared_ptr<const SnapshotStructure> structure, vector<TaskStatus> statuses);
+    // Owner thread, before the executor starts: statuses are the tasks' current ones
+    void beginRun(shared_ptr<const SnapshotStructure> structure, const vector<TaskStatus> &statuses);
+    // Owner thread, after the executor has returned
+    void endRun();
+
+    // Structure of the current snapshot (owner thread), null before the first publish
+    shared_ptr<const SnapshotStructure> getCurrentStructure();
+    void setRefreshInterval(int ms);
+
+    void onTaskStarted(Task *task, int worker_id) override;
+    void onTaskCompleted(Task *task, int worker_id) override;
+};
+
+#endif // SNAPSHOT_PUBLISHER_H
@@ -1,15 +1,35 @@
 #include "task.h"
 #include <iostream>
 #include <iomanip>
-#include <windows.h>
+#include <chrono>
+#include <thread>
 
 using namespace std;
 
-// Constructor - Initialize task with given parameters
+// Constructor - Initialize standalone task with given parameters
 Task::Task(int id, const string &name, int priority, int deadline, int time)
-    : id(id), name(name), priority(priority), deadline(deadline),
-      status(PENDING), estimated_time(time)
+    : id(id), store(nullptr), row(0), own_store(new TaskStore()), unmet_dependencies(0)
 {
+    store = own_store.get();
+    row = store->addRow(name, priority, deadline, time);
+}
+
+// Constructor - Bind to a row that already exists in a shared store
+Task::Task(int id, TaskStore *store, int row)
+    : id(id), store(store), row(row), unmet_dependencies(0)
+{
+}
+
+// Copy constructor - Snapshot the other task's values into private storage
+// The copy keeps the same dependencies and readiness, but no task waits on it
+Task::Task(const Task &other)
+    : id(other.id), store(nullptr), row(0), own_store(new TaskStore()),
+      subtasks(other.subtasks), dependencies(other.dependencies),
+      unmet_dependencies(other.unmet_dependencies.load())
+{
+    store = own_store.get();
+    row = store->addRow(other.getName(), other.getPriority(), other.getDeadline(), other.getEstimatedTime());
+    store->setStatus(row, other.getStatus());
 }
 
 // Destructor
@@ -25,27 +45,27 @@ int Task::getId() const
 
 string Task::getName() const
 {
-    return name;
+    return store->getName(row);
 }
 
 int Task::getPriority() const
 {
-    return priority;
+    return store->getPriority(row);
 }
 
 int Task::getDeadline() const
 {
-    return deadline;
+    return store->getDeadline(row);
 }
 
 TaskStatus Task::getStatus() const
 {
-    return status;
+    return store->getStatus(row);
 }
 
 int Task::getEstimatedTime() const
 {
-    return estimated_time;
+    return store->getEstimatedTime(row);
 }
 
 const vector<Task *> &Task::getSubtasks() const
@@ -58,47 +78,91 @@ const vector<Task *> &Task::getDependencies() const
     return dependencies;
 }
 
+const vector<Task *> &Task::getDependents() const
+{
+    return dependents;
+}
+
+// Change the deadline of this task
+void Task::setDeadline(int days)
+{
+    store->setDeadline(row, days);
+}
+
 // Add a subtask to this task
 void Task::addSubtask(Task *t)
 {
     if (t != nullptr)
+    {
         subtasks.push_back(t);
+        store->bumpVersion();
+    }
 }
 
 // Add a dependency that must complete before this task
 void Task::addDependency(Task *t)
 {
     if (t != nullptr)
+    {
         dependencies.push_back(t);
+        t->dependents.push_back(this);
+        if (t->getStatus() != COMPLETED)
+            unmet_dependencies++;
+        store->bumpVersion();
+    }
+}
+
+// Pre-size the edge lists when the final degree is known (bulk loading)
+void Task::reserveEdges(size_t subtask_count, size_t dependency_count, size_t dependent_count)
+{
+    subtasks.reserve(subtask_count);
+    dependencies.reserve(dependency_count);
+    dependents.reserve(dependent_count);
 }
 
 // Check if all dependencies are completed
 bool Task::isReady() const
 {
-    for (const Task *dep : dependencies)
-    {
-        if (dep->getStatus() != COMPLETED)
-            return false;
-    }
-    return true;
+    return unmet_dependencies.load() == 0;
 }
 
 // Execute the task (simulated with sleep)
 void Task::execute()
 {
-    status = RUNNING;
-    Sleep(estimated_time * 1000); // Sleep for estimated time
-    status = COMPLETED;
+    store->setStatus(row, RUNNING);
+    this_thread::sleep_for(chrono::seconds(getEstimatedTime())); // Sleep for estimated time
+    markComplete();
 }
 
 // Mark task as complete
-void Task::markComplete()
+// Each dependent's counter drops by one per edge; the thread that takes it to
+// zero is the one that reports the dependent as ready
+void Task::markComplete(vector<Task *> *newly_ready)
+{
+    if (getStatus() == COMPLETED)
+        return;
+    store->setStatus(row, COMPLETED);
+    for (Task *dependent : dependents)
+    {
+        if (dependent->unmet_dependencies.fetch_sub(1) == 1 && newly_ready != nullptr)
+            newly_ready->push_back(dependent);
+    }
+}
+
+// Write priority through to the store
+void Task::setPriority(int value)
 {
-    status = COMPLETED;
+    store->setPriority(row, value);
 }
 
 // Display task info with proper indentation
 void Task::displayInfo(int indent) const
+{
+    printInfoLine(cout, id, getName(), getPriority(), getDeadline(), getStatus(), indent);
+}
+
+void Task::printInfoLine(ostream &out, int id, const string &name, int priority, int deadline,
+                         TaskStatus status, int indent)
 {
     string indentation(indent * 3, ' ');
     string statusStr, statusColor, prefix;
@@ -128,9 +192,9 @@ void Task::displayInfo(int indent) const
     else
         prefix = " |   +-- ";
 
-    cout << indentation << prefix << "Task " << id << ": " << name
-         << " [P=" << priority << ", D=" << deadline << "d, "
-         << statusColor << statusStr << "\033[0m" << "]" << endl;
+    out << indentation << prefix << "Task " << id << ": " << name
+        << " [P=" << priority << ", D=" << deadline << "d, "
+        << statusColor << statusStr << "\033[0m" << "]" << endl;
 }
 
 // Display task hierarchy recursively
@@ -155,22 +219,22 @@ int Task::getTotalSubtasks() const
 // Comparison operators - Compare by priority
 bool Task::operator<(const Task &other) const
 {
-    return this->priority < other.priority;
+    return this->getPriority() < other.getPriority();
 }
 
 bool Task::operator>(const Task &other) const
 {
-    return this->priority > other.priority;
+    return this->getPriority() > other.getPriority();
 }
 
 bool Task::operator<=(const Task &other) const
 {
-    return this->priority <= other.priority;
+    return this->getPriority() <= other.getPriority();
 }
 
 bool Task::operator>=(const Task &other) const
 {
-    return this->priority >= other.priority;
+    return this->getPriority() >= other.getPriority();
 }
 
 bool Task::operator==(const Task &other) const
@@ -187,59 +251,59 @@ bool Task::operator!=(const Task &other) const
 Task Task::operator+(int value) const
 {
     Task result = *this;
-    result.priority = min(10, max(1, this->priority + value)); // Clamp to 1-10
+    result.setPriority(min(10, max(1, this->getPriority() + value))); // Clamp to 1-10
     return result;
 }
 
 Task Task::operator-(int value) const
 {
     Task result = *this;
-    result.priority = min(10, max(1, this->priority - value)); // Clamp to 1-10
+    result.setPriority(min(10, max(1, this->getPriority() - value))); // Clamp to 1-10
     return result;
 }
 
 // Compound assignment - Modify priority in place
 Task &Task::operator+=(int value)
 {
-    this->priority = min(10, max(1, this->priority + value));
+    setPriority(min(10, max(1, getPriority() + value)));
     return *this;
 }
 
 Task &Task::operator-=(int value)
 {
-    this->priority = min(10, max(1, this->priority - value));
+    setPriority(min(10, max(1, getPriority() - value)));
     return *this;
 }
 
 // Increment operators
 Task &Task::operator++() // Pre-increment
 {
-    if (this->priority < 10)
-        this->priority++;
+    if (getPriority() < 10)
+        setPriority(getPriority() + 1);
     return *this;
 }
 
 Task Task::operator++(int) // Post-increment
 {
     Task temp = *this;
-    if (this->priority < 10)
-        this->priority++;
+    if (getPriority() < 10)
+        setPriority(getPriority() + 1);
     return temp;
 }
 
 // Decrement operators
 Task &Task::operator--() // Pre-decrement
 {
-    if (this->priority > 1)
-        this->priority--;
+    if (getPriority() > 1)
+        setPriority(getPriority() - 1);
     return *this;
 }
 
 Task Task::operator--(int) // Post-decrement
 {
     Task temp = *this;
-    if (this->priority > 1)
-        this->priority--;
+    if (getPriority() > 1)
+        setPriority(getPriority() - 1);
     return temp;
 }
 
@@ -247,7 +311,7 @@ Task Task::operator--(int) // Post-decrement
 ostream &operator<<(ostream &os, const Task &task)
 {
     string statusStr;
-    switch (task.status)
+    switch (task.getStatus())
     {
     case PENDING:
         statusStr = "PENDING";
@@ -260,11 +324,11 @@ ostream &operator<<(ostream &os, const Task &task)
         break;
     }
 
-    os << "Task[ID=" << task.id << ", Name=\"" << task.name
-       << "\", Priority=" << task.priority
-       << ", Deadline=" << task.deadline << "d"
+    os << "Task[ID=" << task.id << ", Name=\"" << task.getName()
+       << "\", Priority=" << task.getPriority()
+       << ", Deadline=" << task.getDeadline() << "d"
        << ", Status=" << statusStr
-       << ", Time=" << task.estimated_time << "u]";
+       << ", Time=" << task.getEstimatedTime() << "u]";
     return os;
 }
 
@@ -274,11 +338,11 @@ Task &Task::operator=(const Task &other)
     if (this != &other)
     {
         this->id = other.id;
-        this->name = other.name;
-        this->priority = other.priority;
-        this->deadline = other.deadline;
-        this->status = other.status;
-        this->estimated_time = other.estimated_time;
+        store->setName(row, other.getName());
+        store->setPriority(row, other.getPriority());
+        store->setDeadline(row, other.getDeadline());
+        store->setStatus(row, other.getStatus());
+        store->setEstimatedTime(row, other.getEstimatedTime());
     }
     return *this;
 }
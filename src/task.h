@@ -3,36 +3,44 @@
 
 #include <string>
 #include <vector>
+#include <memory>
+#include <atomic>
+#include <ostream>
+#include "task_store.h"
 
 using namespace std;
 
 // OOP Concept: Encapsulation - Task encapsulates all task-related data and behavior
 // OOP Concept: Composition - Task contains vectors of other Task pointers (subtasks and dependencies)
-
-enum TaskStatus
-{
-    PENDING,
-    RUNNING,
-    COMPLETED
-};
+// Task is a handle: its scalar properties live in one row of a TaskStore.
+// Tasks created by TaskManager share the manager's store; a standalone or copied
+// Task owns a private one-row store, so copies stay independent values.
 
 class Task
 {
 private:
     // OOP Concept: Encapsulation - Private data members
     int id;
-    string name;
-    int priority; // 1-10, 10 is highest
-    int deadline; // Integer days from now
-    TaskStatus status;
-    int estimated_time;          // Simulated execution time units
+    TaskStore *store;             // Columns holding this task's properties
+    int row;                      // Row of this task in store
+    unique_ptr<TaskStore> own_store; // Set only for standalone tasks and copies
     vector<Task *> subtasks;     // OOP Concept: Composition - Contains other tasks
     vector<Task *> dependencies; // OOP Concept: Aggregation - References to other tasks
+    vector<Task *> dependents;   // Reverse edges: tasks that depend on this one
+    atomic<int> unmet_dependencies; // Dependencies not yet COMPLETED
+
+    void setPriority(int value);
 
 public:
-    // Constructor
+    // Constructor - standalone task with its own storage
     Task(int id, const string &name, int priority, int deadline, int time);
 
+    // Constructor - handle to an existing row of a shared store
+    Task(int id, TaskStore *store, int row);
+
+    // Copy constructor - detached copy with its own storage
+    Task(const Task &other);
+
     // Destructor
     ~Task();
 
@@ -45,19 +53,30 @@ public:
     int getEstimatedTime() const;
     const vector<Task *> &getSubtasks() const;
     const vector<Task *> &getDependencies() const;
+    const vector<Task *> &getDependents() const;
+
+    // Reschedule (used by the online deadline queue)
+    void setDeadline(int days);
 
     // Task hierarchy management
     void addSubtask(Task *t);
     void addDependency(Task *t);
+    void reserveEdges(size_t subtask_count, size_t dependency_count, size_t dependent_count = 0);
 
     // Execution control
-    bool isReady() const; // Returns true if all dependencies are COMPLETED
+    bool isReady() const; // Returns true if all dependencies are COMPLETED, O(1)
     void execute();       // Simulate task execution
-    void markComplete();
+    // Mark COMPLETED and release dependents; those that became ready are
+    // appended to newly_ready when given. Safe to call from several threads
+    // for different tasks.
+    void markComplete(vector<Task *> *newly_ready = nullptr);
 
     // Display methods - OOP Concept: Abstraction (hiding implementation details)
     void displayInfo(int indent = 0) const;
     void displayHierarchy(int indent = 0) const; // OOP Concept: Recursion
+    // One hierarchy line for the given values (shared with ReadSnapshot)
+    static void printInfoLine(ostream &out, int id, const string &name, int priority, int deadline,
+                              TaskStatus status, int indent);
 
     // Utility methods
     int getTotalSubtasks() const; // Counts all subtasks recursively
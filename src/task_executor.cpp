@@ -1,21 +1,201 @@
 #include "task_executor.h"
+#include "work_stealing_queue.h"
+#include "deadline_scheduler.h"
+#include "cycle_finder.h"
 #include "config.h"
+#include <sstream>
 #include <iostream>
 #include <iomanip>
-#include <windows.h>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <queue>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
 
 using namespace std;
 
 // Constructor
 TaskExecutor::TaskExecutor(ostream &out)
-    : output(out), total_execution_time(0)
+    : renderer(out), quiet(false), total_execution_time(0), worker_count(1), delay_ms(EXEC_DELAY_MS), metrics(nullptr)
 {
 }
 
+// State of one run (Kahn's algorithm)
+// Readiness comes from each task's own unmet-dependency counter; completing a
+// task hands back the dependents it made ready, so no task is ever re-scanned
+struct TaskExecutor::ExecutionRun
+{
+    vector<Task *> tasks;      // Pending tasks in scheduled order
+    vector<int> position_of;   // Task ID -> position in tasks, -1 if not in this run
+
+    // Sequential mode: ready positions, lowest (earliest scheduled) first
+    priority_queue<int, vector<int>, greater<int>> ready;
+    vector<Task *> released;   // Scratch list filled by Task::markComplete
+    vector<pair<Task *, size_t>> nested; // Nesting stack: task, next subtask to look at
+    vector<char> on_stack;     // Task ID -> currently on the nesting stack
+    vector<uint64_t> ready_since; // When each position became ready (metrics only)
+
+    // Online mode: every task completed, in order (nested subtasks included)
+    bool track_finished;
+    vector<Task *> finished;
+
+    // Parallel mode: one deque per worker
+    vector<unique_ptr<WorkStealingQueue>> queues;
+    atomic<int> in_flight;     // Tasks queued or running
+    unique_ptr<atomic<int>[]> waiting; // Closed gates per task: dependencies + subtasks
+    vector<vector<int>> parents_of;    // Parents gated by each task
+
+    // Idle workers park on work_pushed instead of spinning
+    mutex idle_mutex;
+    condition_variable work_pushed;
+    atomic<unsigned> push_count; // Bumped after every push
+    atomic<int> parked;          // Workers waiting on work_pushed
+
+    ExecutionRun() : track_finished(false), in_flight(0), push_count(0), parked(0) {}
+
+    // Wake up to count parked workers for tasks just pushed. The lock orders the
+    // notify after a parking worker's last check of push_count, so no wakeup is lost
+    void signalWork(int count)
+    {
+        push_count++;
+        if (parked.load() > 0)
+        {
+            lock_guard<mutex> guard(idle_mutex);
+            if (count >= parked.load())
+                work_pushed.notify_all();
+            for (int i = 0; i < count && count < parked.load(); i++)
+                work_pushed.notify_one();
+        }
+    }
+
+    // Wake every parked worker once nothing is in flight any more
+    void signalDone()
+    {
+        lock_guard<mutex> guard(idle_mutex);
+        work_pushed.notify_all();
+    }
+
+    // Park until a task is pushed after seen was read, or the run is over
+    void waitForWork(unsigned seen)
+    {
+        unique_lock<mutex> lock(idle_mutex);
+        parked++;
+        while (push_count.load() == seen && in_flight.load() > 0)
+            work_pushed.wait(lock);
+        parked--;
+    }
+
+    int positionOf(const Task *task) const
+    {
+        int id = task->getId();
+        return (id >= 0 && id < (int)position_of.size()) ? position_of[id] : -1;
+    }
+};
+
 // Main execution method - Run all tasks in order
 void TaskExecutor::runTasks(const vector<Task *> &ordered_tasks, const string &scheduler_name)
 {
-    // Print header
+    if (!quiet)
+        renderer.start();
+    printRunHeader(scheduler_name);
+    notifyRunStarted(scheduler_name, worker_count);
+    int not_ready_count = (worker_count > 1) ? runParallel(ordered_tasks)
+                                             : runSequential(ordered_tasks);
+    printRunSummary(not_ready_count);
+    renderer.stop();
+}
+
+// Online earliest-deadline-first execution
+// A task whose dependencies are not complete is parked on the first unmet one and
+// resubmitted when that dependency finishes, so each task is parked at most once per edge
+// and never twice at the same time. Runs on the calling thread regardless of worker_count
+void TaskExecutor::runOnline(DeadlineScheduler &queue)
+{
+    if (!quiet)
+        renderer.start();
+    printRunHeader(queue.getName() + " (online)");
+    notifyRunStarted(queue.getName() + " (online)", 1);
+
+    ExecutionRun run; // Empty run: readiness is read from the tasks themselves
+    run.track_finished = true;
+    unordered_map<const Task *, vector<Task *>> parked;
+    vector<char> is_parked; // Task ID -> waiting in parked
+
+    Task *task;
+    while ((task = queue.waitForEarliest()) != nullptr)
+    {
+        // Deadline changes made by producers reach the tasks on this thread only
+        queue.applyDeadlineChanges();
+        if (task->getStatus() == COMPLETED)
+            continue;
+
+        Task *blocker = nullptr;
+        for (size_t i = 0; !task->isReady() && blocker == nullptr && i < task->getDependencies().size(); i++)
+        {
+            Task *dep = task->getDependencies()[i];
+            if (dep->getStatus() != COMPLETED)
+                blocker = dep;
+        }
+        if (blocker != nullptr)
+        {
+            // A task submitted again while parked is already waiting on an unmet
+            // dependency and comes back when that one finishes
+            int id = task->getId();
+            if (id >= (int)is_parked.size())
+                is_parked.resize(id + 1, 0);
+            if (!is_parked[id])
+            {
+                is_parked[id] = 1;
+                parked[blocker].push_back(task);
+            }
+            continue;
+        }
+
+        executeTaskWithSubtasks(task, run, 0);
+
+        // Resubmit tasks parked on anything that just finished
+        for (Task *done : run.finished)
+        {
+            auto it = parked.find(done);
+            if (it == parked.end())
+                continue;
+            for (Task *waiting : it->second)
+            {
+                is_parked[waiting->getId()] = 0;
+                queue.submit(waiting);
+            }
+            parked.erase(it);
+        }
+        run.finished.clear();
+    }
+    queue.applyDeadlineChanges();
+
+    // Parked tasks can still have run nested inside a parent
+    vector<Task *> blocked;
+    for (const auto &entry : parked)
+    {
+        for (Task *waiting : entry.second)
+        {
+            if (waiting->getStatus() != COMPLETED)
+                blocked.push_back(waiting);
+        }
+    }
+    int not_ready_count = blocked.empty() ? 0 : reportBlockedTasks(blocked);
+    printRunSummary(not_ready_count);
+    renderer.stop();
+}
+
+// Print the execution banner
+void TaskExecutor::printRunHeader(const string &scheduler_name)
+{
+    if (quiet)
+        return;
+    ostringstream output;
     output << "\n" << COLOR_MAGENTA;
     output << "+============================================+" << endl;
     output << "|        TASK EXECUTION IN PROGRESS         |" << endl;
@@ -26,129 +206,421 @@ void TaskExecutor::runTasks(const vector<Task *> &ordered_tasks, const string &s
         output << "  Scheduler: " << COLOR_YELLOW << scheduler_name << COLOR_RESET << endl;
         output << "  " << string(44, '-') << endl << endl;
     }
+    renderer.postText(output.str());
+}
+
+// Print the closing banner with the run result
+void TaskExecutor::printRunSummary(int not_ready_count)
+{
+    if (quiet)
+        return;
+    ostringstream output;
+    output << "\n+============================================+" << endl;
+    if (not_ready_count == 0)
+        output << "  " << COLOR_GREEN << "[SUCCESS] ALL TASKS COMPLETED!" << COLOR_RESET << endl;
+    else
+        output << "  " << COLOR_YELLOW << "[WARNING] " << not_ready_count 
+               << " TASK(S) NOT READY" << COLOR_RESET << endl;
+    output << "+============================================+\n" << endl;
+    renderer.postText(output.str());
+}
 
-    int executed_count = 0;
-    int not_ready_count = 0;
-    const int MAX_PASSES = 10;  // Prevent infinite loops
-    vector<Task *> remaining_tasks = ordered_tasks;
+// Print the list of tasks that could not run, returns how many there were
+int TaskExecutor::reportBlockedTasks(const vector<Task *> &blocked)
+{
+    if (quiet)
+        return blocked.size();
+    ostringstream output;
+    output << "\n  " << string(44, '-') << endl;
+    output << "  " << COLOR_RED << "[!] WARNING: Cannot make further progress!"
+           << COLOR_RESET << endl;
+    output << "  The following tasks are NOT READY:" << endl;
 
-    // Execute tasks in multiple passes to handle dependencies
-    for (int pass = 0; pass < MAX_PASSES && !remaining_tasks.empty(); ++pass)
+    for (Task *task : blocked)
     {
-        vector<Task *> deferred_tasks;
-        bool progress_made = false;
+        output << "    - Task " << task->getId() << ": " << task->getName()
+               << " (waiting on dependencies)" << endl;
+    }
+    renderer.postText(output.str());
+    return blocked.size();
+}
+
+// Stamp the moment a task entered a ready queue
+void TaskExecutor::markReady(ExecutionRun &run, int position)
+{
+    if (metrics)
+        run.ready_since[position] = ExecutionMetrics::now();
+}
+
+// Queue wait of a task that is about to start (tasks outside the run have none)
+void TaskExecutor::recordWait(const ExecutionRun &run, const Task *task)
+{
+    int position = run.positionOf(task);
+    if (metrics && position >= 0)
+        metrics->record(ExecutionMetrics::TASK_WAIT, ExecutionMetrics::now() - run.ready_since[position]);
+}
 
-        for (Task *task : remaining_tasks)
+// Collect the pending tasks of the run and index them by ID
+// When subtasks_first is set a parent also waits for its subtasks (parallel mode);
+// sequential mode runs subtasks nested inside their parent instead. A subtask that
+// depends on its parent, directly or through other tasks, does not gate the parent
+// (see CycleFinder::findSubtaskGates).
+void TaskExecutor::buildExecutionRun(const vector<Task *> &ordered_tasks, ExecutionRun &run, bool subtasks_first)
+{
+    int max_id = 0;
+    for (Task *task : ordered_tasks)
+        max_id = max(max_id, task->getId());
+    run.position_of.assign(max_id + 1, -1);
+    for (Task *task : ordered_tasks)
+    {
+        if (task->getStatus() != COMPLETED && run.positionOf(task) < 0)
         {
-            // Skip completed tasks
-            if (task->getStatus() == COMPLETED)
-                continue;
+            run.position_of[task->getId()] = run.tasks.size();
+            run.tasks.push_back(task);
+        }
+    }
+    if (metrics)
+        run.ready_since.assign(run.tasks.size(), 0);
 
-            // Defer tasks with unmet dependencies
-            if (!task->isReady())
-            {
-                deferred_tasks.push_back(task);
-                continue;
-            }
+    if (!subtasks_first)
+        return;
 
-            // Execute ready task
-            executeTaskWithSubtasks(task, 0);
-            executed_count++;
-            progress_made = true;
+    // One gate for the dependencies (opened when Task::isReady turns true)
+    // plus one per subtask that has to finish first
+    int task_count = run.tasks.size();
+    run.waiting.reset(new atomic<int>[task_count]);
+    run.parents_of.assign(task_count, vector<int>());
+    for (int i = 0; i < task_count; i++)
+    {
+        // A subtask outside this run can never complete here
+        int gates = 1;
+        for (Task *subtask : run.tasks[i]->getSubtasks())
+        {
+            if (subtask->getStatus() != COMPLETED && run.positionOf(subtask) < 0)
+                gates++;
         }
+        run.waiting[i].store(gates);
+    }
+    for (const pair<int, int> &gate : CycleFinder::findSubtaskGates(run.tasks))
+    {
+        run.parents_of[gate.first].push_back(gate.second);
+        run.waiting[gate.second]++;
+    }
+}
+
+// Report every task of the run that did not complete, returns how many there were
+int TaskExecutor::finishRun(const ExecutionRun &run)
+{
+    vector<Task *> blocked;
+    for (Task *task : run.tasks)
+    {
+        if (task->getStatus() != COMPLETED)
+            blocked.push_back(task);
+    }
+    return blocked.empty() ? 0 : reportBlockedTasks(blocked);
+}
 
-        remaining_tasks = deferred_tasks;
+// Single-threaded Kahn execution, O(V + E) plus the ready heap
+// The heap always picks the earliest scheduled ready task, so the scheduler's
+// order is kept and there is no limit on dependency depth
+int TaskExecutor::runSequential(const vector<Task *> &ordered_tasks)
+{
+    ExecutionRun run;
+    buildExecutionRun(ordered_tasks, run, false);
 
-        // Check for deadlock (no progress possible)
-        if (!progress_made && !remaining_tasks.empty())
+    for (int i = 0; i < (int)run.tasks.size(); i++)
+    {
+        if (run.tasks[i]->isReady())
         {
-            output << "\n  " << string(44, '-') << endl;
-            output << "  " << COLOR_RED << "[!] WARNING: Cannot make further progress!" 
-                   << COLOR_RESET << endl;
-            output << "  The following tasks are NOT READY:" << endl;
-            
-            for (Task *task : remaining_tasks)
-            {
-                output << "    - Task " << task->getId() << ": " << task->getName()
-                       << " (waiting on dependencies)" << endl;
-                not_ready_count++;
-            }
-            break;
+            markReady(run, i);
+            run.ready.push(i);
         }
     }
 
-    // Print summary
-    output << "\n+============================================+" << endl;
-    if (not_ready_count == 0)
-        output << "  " << COLOR_GREEN << "[SUCCESS] ALL TASKS COMPLETED!" << COLOR_RESET << endl;
-    else
-        output << "  " << COLOR_YELLOW << "[WARNING] " << not_ready_count 
-               << " TASK(S) NOT READY" << COLOR_RESET << endl;
-    output << "+============================================+\n" << endl;
+    while (!run.ready.empty())
+    {
+        Task *task = run.tasks[run.ready.top()];
+        run.ready.pop();
+
+        // Already executed as a nested subtask
+        if (task->getStatus() != COMPLETED)
+            executeTaskWithSubtasks(task, run, 0);
+    }
+
+    return finishRun(run);
+}
+
+// Run the task graph on a pool of worker threads
+// A task becomes runnable once its dependencies and its subtasks have completed,
+// so the wall-clock time approaches the critical path instead of the sum of all tasks
+int TaskExecutor::runParallel(const vector<Task *> &ordered_tasks)
+{
+    ExecutionRun run;
+    buildExecutionRun(ordered_tasks, run, true);
+    int task_count = run.tasks.size();
+
+    // Seed the workers with the initially ready tasks, round-robin in scheduled order
+    for (int w = 0; w < worker_count; w++)
+        run.queues.push_back(make_unique<WorkStealingQueue>());
+
+    int next_worker = 0;
+    for (int i = 0; i < task_count; i++)
+    {
+        if (run.tasks[i]->isReady() && run.waiting[i].fetch_sub(1) == 1)
+        {
+            markReady(run, i);
+            run.in_flight++;
+            run.queues[next_worker]->push(run.tasks[i]);
+            next_worker = (next_worker + 1) % worker_count;
+        }
+    }
+
+    vector<thread> workers;
+    for (int w = 0; w < worker_count; w++)
+        workers.emplace_back(&TaskExecutor::workerLoop, this, ref(run), w);
+    for (thread &worker : workers)
+        worker.join();
+
+    return finishRun(run);
+}
+
+// Worker thread body: run own tasks, steal when idle, park when there is nothing
+// to steal, stop when nothing is in flight
+void TaskExecutor::workerLoop(ExecutionRun &run, int worker_id)
+{
+    vector<Task *> released;
+    while (run.in_flight.load() > 0)
+    {
+        // Read before looking, so a push that lands during the scan is not slept through
+        unsigned seen = run.push_count.load();
+        Task *task = nullptr;
+        bool found = run.queues[worker_id]->pop(task);
+        for (int i = 1; !found && i < worker_count; i++)
+            found = run.queues[(worker_id + i) % worker_count]->steal(task);
+
+        if (!found)
+        {
+            run.waitForWork(seen);
+            continue;
+        }
+
+        released.clear();
+        recordWait(run, task);
+        executeOnWorker(task, worker_id, released);
+
+        // Queue released tasks before this one stops counting as in flight
+        int pushed = 0;
+        for (Task *next : released)
+        {
+            int position = run.positionOf(next);
+            if (position >= 0 && openGate(run, position, worker_id))
+                pushed++;
+        }
+        for (int parent : run.parents_of[run.positionOf(task)])
+        {
+            if (openGate(run, parent, worker_id))
+                pushed++;
+        }
+
+        // This worker pops one of them itself; the rest are for parked workers
+        if (pushed > 1)
+            run.signalWork(pushed - 1);
+        if (run.in_flight.fetch_sub(1) == 1)
+            run.signalDone();
+    }
+}
+
+// Open one gate of a task, queue it on this worker once the last one opens
+// Returns true if the task was queued
+bool TaskExecutor::openGate(ExecutionRun &run, int position, int worker_id)
+{
+    if (run.waiting[position].fetch_sub(1) == 1)
+    {
+        markReady(run, position);
+        run.in_flight++;
+        run.queues[worker_id]->push(run.tasks[position]);
+        return true;
+    }
+    return false;
+}
+
+// Execute a single task on a worker thread
+void TaskExecutor::executeOnWorker(Task *task, int worker_id, vector<Task *> &released)
+{
+    printTaskExecution(task, worker_id, 0, true);
+    notifyStarted(task, worker_id);
+
+    uint64_t started = metrics ? ExecutionMetrics::now() : 0;
+    if (delay_ms > 0)
+        this_thread::sleep_for(chrono::milliseconds(task->getEstimatedTime() * delay_ms));
+    task->markComplete(&released);
+    if (metrics)
+        metrics->record(ExecutionMetrics::TASK_RUN, ExecutionMetrics::now() - started);
+    notifyCompleted(task, worker_id);
+
+    total_execution_time += task->getEstimatedTime();
+    printTaskExecution(task, worker_id, 0, false);
 }
 
-// Execute task and all subtasks recursively
-void TaskExecutor::executeTaskWithSubtasks(Task *task, int indent)
+// Execute a task with its ready subtasks nested before it (depth-first)
+// An explicit stack replaces recursion, so a deep subtask chain cannot overflow
+// the call stack; a subtask that is already on the stack (a subtask cycle) is skipped
+void TaskExecutor::executeTaskWithSubtasks(Task *task, ExecutionRun &run, int indent)
 {
     if (task == nullptr || task->getStatus() == COMPLETED)
         return;
 
-    // Print starting status
-    printTaskExecution(task, indent, "RUNNING");
-
-    // Execute subtasks first (depth-first)
-    for (Task *subtask : task->getSubtasks())
+    startNested(task, run, indent);
+    while (!run.nested.empty())
     {
-        if (subtask->getStatus() != COMPLETED && subtask->isReady())
-            executeTaskWithSubtasks(subtask, indent + 1);
+        Task *current = run.nested.back().first;
+        size_t &next_subtask = run.nested.back().second;
+        if (next_subtask < current->getSubtasks().size())
+        {
+            Task *subtask = current->getSubtasks()[next_subtask++];
+            int id = subtask->getId();
+            bool on_stack = id < (int)run.on_stack.size() && run.on_stack[id];
+            if (subtask->getStatus() != COMPLETED && subtask->isReady() && !on_stack)
+                startNested(subtask, run, indent + run.nested.size());
+            continue;
+        }
+
+        // All subtasks handled: run the task itself
+        run.nested.pop_back();
+        completeNested(current, run, indent + run.nested.size());
     }
+}
+
+// Print the starting status of a nested task and push it on the stack
+void TaskExecutor::startNested(Task *task, ExecutionRun &run, int indent)
+{
+    int id = task->getId();
+    if (id >= (int)run.on_stack.size())
+        run.on_stack.resize(id + 1, 0);
+    run.on_stack[id] = 1;
+    run.nested.push_back(make_pair(task, (size_t)0));
+
+    recordWait(run, task);
+    printTaskExecution(task, -1, indent, true);
+    notifyStarted(task, 0);
+}
+
+// Run a nested task whose subtasks are done, and queue what it releases
+void TaskExecutor::completeNested(Task *task, ExecutionRun &run, int indent)
+{
+    run.on_stack[task->getId()] = 0;
 
     // Show progress animation
+    uint64_t started = metrics ? ExecutionMetrics::now() : 0;
     showProgressAnimation(task, indent);
 
     // Mark complete and update time
-    task->markComplete();
+    run.released.clear();
+    task->markComplete(&run.released);
+    if (metrics)
+        metrics->record(ExecutionMetrics::TASK_RUN, ExecutionMetrics::now() - started);
+    notifyCompleted(task, 0);
     total_execution_time += task->getEstimatedTime();
 
+    if (run.track_finished)
+        run.finished.push_back(task);
+
+    // Queue the waiting tasks that just became ready
+    for (Task *next : run.released)
+    {
+        int position = run.positionOf(next);
+        if (position >= 0)
+        {
+            markReady(run, position);
+            run.ready.push(position);
+        }
+    }
+
     // Print completion status
-    printTaskExecution(task, indent, "COMPLETED");
+    printTaskExecution(task, -1, indent, false);
 }
 
-// Display progress bar animation
+// Simulate the task's work; the renderer animates the progress bar meanwhile
 void TaskExecutor::showProgressAnimation(Task *task, int indent)
 {
-    string indentation(indent * 2, ' ');
-    int estimatedTime = task->getEstimatedTime();
+    int estimated_time = task->getEstimatedTime();
+    int steps = (estimated_time > 10) ? 10 : estimated_time;
+    chrono::milliseconds work(estimated_time * delay_ms);
+    if (!quiet)
+        renderer.postProgressStart(indent, steps, chrono::duration_cast<chrono::nanoseconds>(work).count());
+    if (delay_ms > 0)
+        this_thread::sleep_for(work);
+    if (!quiet)
+        renderer.postProgressEnd();
+}
 
-    output << "  " << indentation << COLOR_CYAN << "    Progress: [";
-    output.flush();
+// Queue a RUNNING/COMPLETED line; worker_id < 0 omits the [W<n>] prefix
+void TaskExecutor::printTaskExecution(Task *task, int worker_id, int indent, bool running)
+{
+    if (!quiet)
+        renderer.postTask(running ? ProgressRenderer::TASK_RUNNING : ProgressRenderer::TASK_COMPLETED,
+                          task, worker_id, indent);
+}
 
-    int steps = (estimatedTime > 10) ? 10 : estimatedTime;
-    int delayPerStep = (estimatedTime * EXEC_DELAY_MS) / steps;
+// Set number of worker threads (1 keeps the sequential animated mode)
+void TaskExecutor::setWorkerCount(int workers)
+{
+    worker_count = (workers < 1) ? 1 : workers;
+}
 
-    for (int i = 0; i < steps; i++)
-    {
-        output << "=";
-        output.flush();
-        Sleep(delayPerStep);
-    }
+int TaskExecutor::getWorkerCount() const
+{
+    return worker_count;
+}
+
+void TaskExecutor::addListener(ExecutionListener *listener)
+{
+    if (listener != nullptr)
+        listeners.push_back(listener);
+}
+
+void TaskExecutor::removeListener(ExecutionListener *listener)
+{
+    listeners.erase(remove(listeners.begin(), listeners.end(), listener), listeners.end());
+}
 
-    output << "] 100%" << COLOR_RESET << endl;
-    output.flush();
+// Forward execution events to every registered listener
+void TaskExecutor::notifyRunStarted(const string &scheduler_name, int workers)
+{
+    for (ExecutionListener *listener : listeners)
+        listener->onRunStarted(scheduler_name, workers);
 }
 
-// Print task execution status with formatting
-void TaskExecutor::printTaskExecution(Task *task, int indent, const string &action)
+void TaskExecutor::notifyStarted(Task *task, int worker_id)
 {
-    string indentation(indent * 2, ' ');
-    string actionColor = (action == "RUNNING") ? COLOR_BLUE : COLOR_GREEN;
-    string actionSymbol = (action == "RUNNING") ? "[~]" : "[+]";
+    for (ExecutionListener *listener : listeners)
+        listener->onTaskStarted(task, worker_id);
+}
 
-    output << "  " << indentation << actionColor << actionSymbol << " " 
-           << action << COLOR_RESET << ": Task" << task->getId() << " - " 
-           << task->getName() << " (P=" << task->getPriority()
-           << ", D=" << task->getDeadline() << "d)" << endl;
-    output.flush();
+void TaskExecutor::notifyCompleted(Task *task, int worker_id)
+{
+    for (ExecutionListener *listener : listeners)
+        listener->onTaskCompleted(task, worker_id);
+}
+
+void TaskExecutor::setQuiet(bool enabled)
+{
+    quiet = enabled;
+}
+
+void TaskExecutor::setRefreshInterval(int ms)
+{
+    renderer.setRefreshInterval(ms);
+}
+
+void TaskExecutor::setMetrics(ExecutionMetrics *target)
+{
+    metrics = target;
+}
+
+void TaskExecutor::setDelayPerUnit(int ms)
+{
+    delay_ms = (ms < 0) ? 0 : ms;
 }
 
 // Get total execution time
@@ -4,7 +4,13 @@
 #include <vector>
 #include <ostream>
 #include <iostream>
+#include <atomic>
 #include "task.h"
+#include "execution_listener.h"
+#include "execution_metrics.h"
+#include "progress_renderer.h"
+
+class DeadlineScheduler;
 
 using namespace std;
 
@@ -14,13 +20,40 @@ using namespace std;
 class TaskExecutor
 {
 private:
-    ostream &output; // OOP Concept: Composition - Contains reference to output stream
-    int total_execution_time;
+    ProgressRenderer renderer; // OOP Concept: Composition - Writes all run output to the stream
+    bool quiet;                // No output at all
+    atomic<int> total_execution_time;
+    int worker_count; // 1 = sequential, >1 = parallel work-stealing pool
+    int delay_ms;     // Real time per simulated time unit (0 = no waiting)
+    vector<ExecutionListener *> listeners; // Observers of task start/completion
+    ExecutionMetrics *metrics;             // Queue-wait/run histograms (null = off)
+
+    // Dependency-counter state of one run (defined in task_executor.cpp)
+    struct ExecutionRun;
 
     // Helper methods
-    void executeTaskWithSubtasks(Task *task, int indent = 0);
-    void printTaskExecution(Task *task, int indent, const string &action);
+    void printRunHeader(const string &scheduler_name);
+    void printRunSummary(int not_ready_count);
+    void executeTaskWithSubtasks(Task *task, ExecutionRun &run, int indent = 0);
+    void startNested(Task *task, ExecutionRun &run, int indent);
+    void completeNested(Task *task, ExecutionRun &run, int indent);
+    void printTaskExecution(Task *task, int worker_id, int indent, bool running);
     void showProgressAnimation(Task *task, int indent);
+    int reportBlockedTasks(const vector<Task *> &blocked);
+
+    // Ready-queue execution engines, both return the number of blocked tasks
+    void buildExecutionRun(const vector<Task *> &ordered_tasks, ExecutionRun &run, bool subtasks_first);
+    int finishRun(const ExecutionRun &run);
+    int runSequential(const vector<Task *> &ordered_tasks);
+    int runParallel(const vector<Task *> &ordered_tasks);
+    void workerLoop(ExecutionRun &run, int worker_id);
+    bool openGate(ExecutionRun &run, int position, int worker_id);
+    void executeOnWorker(Task *task, int worker_id, vector<Task *> &released);
+    void notifyRunStarted(const string &scheduler_name, int workers);
+    void notifyStarted(Task *task, int worker_id);
+    void notifyCompleted(Task *task, int worker_id);
+    void markReady(ExecutionRun &run, int position);
+    void recordWait(const ExecutionRun &run, const Task *task);
 
 public:
     // Constructor takes output stream (default is cout)
@@ -29,6 +62,29 @@ public:
     // OOP Concept: Abstraction - High-level execution interface
     void runTasks(const vector<Task *> &ordered_tasks, const string &scheduler_name = "");
 
+    // Drain an online EDF queue until it is closed; tasks may be submitted
+    // or rescheduled from other threads while this runs
+    void runOnline(DeadlineScheduler &queue);
+
+    // Number of worker threads used by runTasks
+    void setWorkerCount(int workers);
+    int getWorkerCount() const;
+
+    // Register an observer (not owned); call before runTasks
+    void addListener(ExecutionListener *listener);
+    void removeListener(ExecutionListener *listener);
+
+    // Quiet mode skips all run output (batch runs without a log)
+    void setQuiet(bool enabled);
+    // Milliseconds between screen refreshes of the progress output
+    void setRefreshInterval(int ms);
+
+    // Record per-task queue wait and run time into metrics (not owned, null to stop)
+    void setMetrics(ExecutionMetrics *target);
+
+    // Milliseconds slept per estimated time unit (default EXEC_DELAY_MS)
+    void setDelayPerUnit(int ms);
+
     // Get total simulated execution time
     int getTotalExecutionTime() const;
 
@@ -1,23 +1,32 @@
 #include "task_manager.h"
 #include "priority_scheduler.h"
+#include "snapshot.h"
+#include "cycle_finder.h"
 #ifndef D2_MODE
 #include "deadline_scheduler.h"
 #include "hierarchical_scheduler.h"
+#include "critical_path_scheduler.h"
+#include "optimizing_scheduler.h"
 #endif
 #include <iostream>
+#include <fstream>
 #include <limits>
-#include <set>
+#include <iomanip>
+#include <algorithm>
+#include <thread>
 
 using namespace std;
 
 // OOP Concept: Encapsulation
-TaskManager::TaskManager() : next_task_id(1), completed_tasks(0), total_simulated_time(0), last_scheduler_name("PriorityScheduler")
+TaskManager::TaskManager(ostream &execution_log) : executor(execution_log), next_task_id(1), cached_version(0), schedule_valid(false), scheduler_changes(0), cyclic_edge_count(0), root_count(0), total_descendants(0), descendants_valid(true), journal_generation(0), journal_replayed(0), journal_compact_records(1000000), journal_failure_shown(false), event_log(nullptr), completed_tasks(0), total_simulated_time(0), last_scheduler_name("PriorityScheduler")
 {
 #ifdef D2_MODE
     priority_scheduler = new PriorityScheduler();
 #else
     current_scheduler = make_unique<PriorityScheduler>();
 #endif
+    executor.setMetrics(&metrics);
+    executor.addListener(&snapshots);
 }
 
 void TaskManager::printHeader() const
@@ -42,7 +51,9 @@ void TaskManager::printMenu() const
 #ifndef D2_MODE
     cout << "|                                                              |\n| TEMPLATE DEMONSTRATIONS                                      |\n"
          << "| [11] Task Statistics (Template)                              |\n| [12] Generic Container Demo                                  |\n"
-         << "| [13] Generic Comparator Demo                                 |\n";
+         << "| [13] Generic Comparator Demo                                 |\n|                                                              |\n"
+         << "| EXECUTION SETTINGS                                           |\n| [14] Set Worker Threads (Parallel Mode)                      |\n"
+         << "| [15] Simulate Execution (Virtual Clock)                      |\n";
 #endif
     cout << "|                                                              |\n| [0] Exit                                                     |\n"
          << "+--------------------------------------------------------------+\nEnter your choice: ";
@@ -120,6 +131,12 @@ void TaskManager::run()
         case 13:
             comparatorDemo();
             break;
+        case 14:
+            chooseWorkerCount();
+            break;
+        case 15:
+            simulateAllTasks();
+            break;
 #endif
         case 0:
             cout << "\n"
@@ -129,6 +146,9 @@ void TaskManager::run()
         default:
             printError("Invalid choice! Please try again.");
         }
+        // Each menu action is durable once it returns
+        if (!commitJournal())
+            reportJournalFailure();
         cout << endl;
     }
 }
@@ -172,9 +192,9 @@ void TaskManager::addNewTask()
     printSection("Add New Task");
     cout << "Task Name: ";
     getline(cin, name);
-    int priority = getValidatedInt("Priority (1-10, 10=highest): ", 1, 10);
-    int deadline = getValidatedInt("Deadline (days from now): ", 0, 9999);
-    int time = getValidatedInt("Execution Time (units): ", 1, 9999);
+    int priority = getValidatedInt("Priority (1-10, 10=highest): ", MIN_PRIORITY, MAX_PRIORITY);
+    int deadline = getValidatedInt("Deadline (days from now): ", 0, MAX_DEADLINE);
+    int time = getValidatedInt("Execution Time (units): ", MIN_TIME, MAX_TIME);
     cin.ignore(numeric_limits<streamsize>::max(), '\n');
     Task *new_task = createTask(name, priority, deadline, time);
     printSuccess("Task created!");
@@ -224,9 +244,13 @@ void TaskManager::setTaskDependency()
         printError("A task cannot depend on itself!");
         return;
     }
-    addDependency(task_id, dependency_id);
-    if (hasCircularDependencies())
-        printWarning("This dependency may create a cycle!");
+    if (!addDependency(task_id, dependency_id))
+    {
+        printWarning("Dependency recorded, but it creates a cycle!");
+        cout << "  Task #" << task_id << " now depends on Task #" << dependency_id
+             << "; Execute All Tasks will refuse to run while this cycle exists" << endl;
+        return;
+    }
     printSuccess("Dependency added!");
     cout << "  Task #" << task_id << " now depends on Task #" << dependency_id << endl;
 }
@@ -237,7 +261,8 @@ void TaskManager::chooseSchedulingStrategy()
     cout << "\n"
          << COLOR_CYAN << "+--------------------------------------------------------------+\n|              SELECT SCHEDULING STRATEGY                      |\n"
          << "+--------------------------------------------------------------+" << COLOR_RESET << "\n  [1] Priority Based (highest priority first)\n"
-         << "  [2] Deadline Based (earliest deadline first)\n  [3] Hierarchical (parent tasks first)\n\nYour choice: ";
+         << "  [2] Deadline Based (earliest deadline first)\n  [3] Hierarchical (parent tasks first)\n"
+         << "  [4] Critical Path (longest remaining path first)\n  [5] Optimized (local search for the current worker count)\n\nYour choice: ";
     int choice;
     if (!(cin >> choice))
     {
@@ -261,10 +286,50 @@ void TaskManager::chooseSchedulingStrategy()
         setScheduler(make_unique<HierarchicalScheduler>());
         printSuccess("HierarchicalScheduler activated!");
         break;
+    case 4:
+        setScheduler(make_unique<CriticalPathScheduler>());
+        printSuccess("CriticalPathScheduler activated!");
+        break;
+    case 5:
+    {
+        int seconds = getValidatedInt("Search time in seconds (1-60): ", 1, 60);
+        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+        setScheduler(make_unique<OptimizingScheduler>(make_unique<CriticalPathScheduler>(), executor.getWorkerCount(), seconds * 1000));
+        printSuccess("OptimizingScheduler activated!");
+        break;
+    }
     default:
         printError("Invalid choice! Keeping current scheduler.");
     }
 }
+
+void TaskManager::chooseWorkerCount()
+{
+    printSection("Set Worker Threads");
+    cout << "  Current workers: " << executor.getWorkerCount() << "\n  Hardware threads: " << thread::hardware_concurrency()
+         << "\n  (1 = sequential execution with progress animation)\n";
+    int workers = getValidatedInt("Worker threads (1-256): ", 1, 256);
+    cin.ignore(numeric_limits<streamsize>::max(), '\n');
+    setWorkerCount(workers);
+    printSuccess(workers == 1 ? "Sequential execution selected!" : "Parallel execution enabled!");
+}
+
+void TaskManager::simulateAllTasks()
+{
+    if (all_tasks.empty())
+    {
+        printError("No tasks to simulate!");
+        return;
+    }
+    if (!current_scheduler)
+    {
+        printWarning("No scheduler selected. Using default PriorityScheduler.");
+        setScheduler(make_unique<PriorityScheduler>());
+    }
+    SimulationResult result;
+    simulateAll(result);
+    printSimulationReport(cout, result, true, 20);
+}
 #endif
 
 void TaskManager::displayTaskHierarchy() const
@@ -274,17 +339,13 @@ void TaskManager::displayTaskHierarchy() const
         printError("No tasks to display!");
         return;
     }
+    refreshSnapshot();
+    SnapshotPublisher::Reader snapshot(snapshots);
     cout << "\n"
          << COLOR_CYAN << "+============================================+\n|           TASK HIERARCHY VIEW              |\n"
          << "+============================================+" << COLOR_RESET << "\n\nLegend: [P=Priority, D=Deadline(days)]\n"
          << endl;
-    set<int> subtask_ids;
-    for (const auto &task_ptr : all_tasks)
-        for (const Task *subtask : task_ptr->getSubtasks())
-            subtask_ids.insert(subtask->getId());
-    for (const auto &task_ptr : all_tasks)
-        if (subtask_ids.find(task_ptr->getId()) == subtask_ids.end())
-            task_ptr->displayHierarchy(0);
+    snapshot->displayHierarchy(cout);
     cout << "\n+============================================+" << endl;
 }
 
@@ -302,126 +363,853 @@ void TaskManager::executeAllTasks()
     if (!current_scheduler)
     {
         printWarning("No scheduler selected. Using default PriorityScheduler.");
-        current_scheduler = make_unique<PriorityScheduler>();
+        setScheduler(make_unique<PriorityScheduler>());
     }
 #endif
     if (hasCircularDependencies())
     {
         cout << "\n"
              << COLOR_RED << "+============================================+\n|               ERROR DETECTED               |\n"
-             << "+============================================+" << COLOR_RESET << "\n  Circular dependencies found!\n  Please review and fix task dependencies." << endl;
+             << "+============================================+" << COLOR_RESET << "\n  Circular dependencies found!\n";
+        vector<vector<int>> cycles = findDependencyCycles();
+        for (size_t i = 0; i < cycles.size(); i++)
+        {
+            cout << "  Cycle " << (i + 1) << " (" << cycles[i].size() << " tasks): ";
+            for (size_t j = 0; j < cycles[i].size(); j++)
+                cout << (j ? ", " : "") << "#" << cycles[i][j];
+            cout << "\n";
+        }
+        cout << "  Please review and fix task dependencies." << endl;
         return;
     }
-    executeAll();
+    if (!executeAll())
+        reportJournalFailure();
 }
 
-void TaskManager::printSummaryReport() const
+void TaskManager::printSummaryReport() const { printSummaryReport(cout, true); }
+
+void TaskManager::writeSummaryReport(ostream &out) const { printSummaryReport(out, false); }
+
+void TaskManager::writeSimulationReport(ostream &out, const SimulationResult &result) const
 {
-    cout << "\n"
-         << COLOR_GREEN << "+============================================+\n|          EXECUTION SUMMARY REPORT          |\n"
-         << "+============================================+" << COLOR_RESET << endl;
-    int total_root_tasks = 0, total_subtasks = 0, completed = 0;
-    set<int> subtask_ids;
-    for (const auto &task_ptr : all_tasks)
-        for (const Task *subtask : task_ptr->getSubtasks())
-            subtask_ids.insert(subtask->getId());
-    for (const auto &task_ptr : all_tasks)
-    {
-        total_subtasks += task_ptr->getTotalSubtasks();
-        if (task_ptr->getStatus() == COMPLETED)
-            completed++;
-        if (subtask_ids.find(task_ptr->getId()) == subtask_ids.end())
-            total_root_tasks++;
-    }
-    int overall_tasks = all_tasks.size();
-    cout << "\n  >> Total Root Tasks: " << total_root_tasks << "\n  >> Total Subtasks (nested): " << total_subtasks
-         << "\n  >> Overall Tasks Executed: " << overall_tasks << "\n  >> Completed Successfully: " << COLOR_GREEN << completed << COLOR_RESET << " / " << overall_tasks
-         << "\n  >> Scheduler Used: " << COLOR_YELLOW << last_scheduler_name << COLOR_RESET << "\n  >> Simulated Execution Time: " << total_simulated_time << " units\n"
-         << "\n+============================================+" << endl;
+    printSimulationReport(out, result, false, result.timings.size());
+}
+
+void TaskManager::printSimulationReport(ostream &out, const SimulationResult &result, bool color, size_t max_rows) const
+{
+    const char *cyan = color ? COLOR_CYAN : "", *red = color ? COLOR_RED : "", *reset = color ? COLOR_RESET : "";
+    int workers = executor.getWorkerCount();
+    out << "\n"
+        << cyan << "+============================================+\n|        SIMULATION REPORT (VIRTUAL)         |\n"
+        << "+============================================+" << reset
+        << "\n  >> Scheduler Used: " << last_scheduler_name << "\n  >> Workers: " << workers
+        << "\n  >> Makespan: " << result.makespan << " units\n  >> Total Work: " << result.total_work
+        << " units (" << static_cast<int>(result.utilization(workers) * 100 + 0.5) << "% utilization)"
+        << "\n  >> Late Tasks: " << result.late_count << " (max lateness " << result.max_lateness
+        << ", total " << result.total_lateness << ")\n  >> Blocked Tasks: " << result.blocked_count << "\n";
+
+    size_t rows = min(max_rows, result.timings.size());
+    if (rows > 0)
+        out << "\n  Task                     Worker   Start  Finish\n";
+    for (size_t i = 0; i < rows; i++)
+    {
+        const TaskTiming &timing = result.timings[i];
+        string label = "Task" + to_string(timing.task->getId()) + " - " + timing.task->getName();
+        out << "  " << left << setw(24) << label << right << setw(7) << ("W" + to_string(timing.worker))
+            << setw(8) << timing.start << setw(8) << timing.finish;
+        if (timing.lateness > 0)
+            out << "  " << red << "LATE +" << timing.lateness << reset;
+        out << "\n";
+    }
+    if (rows < result.timings.size())
+        out << "  ... " << result.timings.size() - rows << " more\n";
+    out << "\n+============================================+" << endl;
+}
+
+void TaskManager::printSummaryReport(ostream &out, bool color) const
+{
+    const char *green = color ? COLOR_GREEN : "", *yellow = color ? COLOR_YELLOW : "", *reset = color ? COLOR_RESET : "";
+    out << "\n"
+        << green << "+============================================+\n|          EXECUTION SUMMARY REPORT          |\n"
+        << "+============================================+" << reset << endl;
+    refreshSnapshot();
+    SnapshotPublisher::Reader snapshot(snapshots);
+    int total_root_tasks = snapshot->getRootCount();
+    int completed = snapshot->getCompletedCount();
+    long long total_subtasks = snapshot->getTotalDescendants();
+    int overall_tasks = snapshot->getTaskCount();
+    out << "\n  >> Total Root Tasks: " << total_root_tasks << "\n  >> Total Subtasks (nested): " << total_subtasks
+        << "\n  >> Overall Tasks Executed: " << overall_tasks << "\n  >> Completed Successfully: " << green << completed << reset << " / " << overall_tasks
+        << "\n  >> Scheduler Used: " << yellow << last_scheduler_name << reset << "\n  >> Simulated Execution Time: " << total_simulated_time << " units\n"
+        << "\n  >> Latency:\n";
+    metrics.printReport(out);
+    out << "\n+============================================+" << endl;
+}
+
+void TaskManager::writeMetrics(ostream &out) const { metrics.writePrometheus(out); }
+
+bool TaskManager::exportMetrics(const string &path) const
+{
+    ofstream file(path);
+    if (!file)
+        return false;
+    writeMetrics(file);
+    return file.good();
 }
 
 Task *TaskManager::createTask(const string &name, int priority, int deadline, int time)
 {
-    auto task = make_unique<Task>(next_task_id, name, priority, deadline, time);
-    Task *task_ptr = task.get();
-    task_map[next_task_id] = task_ptr;
-    all_tasks.push_back(move(task));
+    // Row index is always ID - 1, so lookups by ID index the store directly
+    int row = task_store.addRow(name, priority, deadline, time);
+    all_tasks.emplace_back(next_task_id, &task_store, row);
+    Task *task_ptr = &all_tasks.back();
+    dependency_order.addNode(next_task_id);
+    parent_counts.push_back(0);
+    root_ids.push_back(next_task_id);
+    root_count++;
+    descendant_counts.push_back(0);
     next_task_id++;
+    if (journal)
+    {
+        journal->logCreateTask(name, priority, deadline, time);
+        compactJournalIfLarge();
+    }
+    if (event_log)
+        event_log->log(EVENT_TASK_CREATED, task_ptr->getId(), priority);
     return task_ptr;
 }
 
 void TaskManager::addSubtask(int parent_id, int subtask_id)
 {
     Task *parent = findTaskById(parent_id), *subtask = findTaskById(subtask_id);
-    if (parent && subtask)
-        parent->addSubtask(subtask);
+    if (!parent || !subtask)
+        return;
+    parent->addSubtask(subtask);
+    recordSubtaskEdge(parent_id, subtask_id);
+    if (journal)
+    {
+        journal->logSubtask(parent_id, subtask_id);
+        compactJournalIfLarge();
+    }
+    if (event_log)
+        event_log->log(EVENT_SUBTASK_ADDED, parent_id, subtask_id);
 }
 
-void TaskManager::addDependency(int task_id, int dependency_id)
+// The edge is always recorded; an edge that closes a cycle is counted so
+// hasCircularDependencies() can answer without walking the graph
+bool TaskManager::addDependency(int task_id, int dependency_id)
 {
     Task *task = findTaskById(task_id), *dependency = findTaskById(dependency_id);
-    if (task && dependency)
-        task->addDependency(dependency);
+    if (!task || !dependency)
+        return false;
+    task->addDependency(dependency);
+    if (journal)
+    {
+        journal->logDependency(task_id, dependency_id);
+        compactJournalIfLarge();
+    }
+    if (event_log)
+        event_log->log(EVENT_DEPENDENCY_ADDED, task_id, dependency_id);
+    if (dependency_order.addEdge(dependency_id, task_id))
+        return true;
+    cyclic_edge_count++;
+    return false;
+}
+
+// Grow a list to hold extra more items, at least doubling so repeated small
+// batches stay amortized O(1) per item
+static size_t grownCapacity(size_t size, size_t extra)
+{
+    return max(size + extra, 2 * size);
+}
+
+int TaskManager::createTasks(const vector<TaskSpec> &specs)
+{
+    int first_id = next_task_id;
+    size_t capacity = grownCapacity(all_tasks.size(), specs.size());
+    task_store.reserve(capacity);
+    parent_counts.reserve(capacity);
+    descendant_counts.reserve(capacity);
+    root_ids.reserve(grownCapacity(root_ids.size(), specs.size()));
+    dependency_order.reserve(capacity + 1);
+    for (const TaskSpec &spec : specs)
+        createTask(spec.name, spec.priority, spec.deadline, spec.time);
+    return first_id;
+}
+
+// Edges are bucketed by task with a counting sort, duplicates are dropped with a
+// per-task stamp over the dependency rows, and every edge list is sized before the
+// first insertion. A batch that is large next to the graph rebuilds the topological
+// order in one O(V + E) pass; a small one goes through the incremental order.
+bool TaskManager::addDependencies(const vector<pair<int, int>> &edges, string &error, size_t *added)
+{
+    if (added)
+        *added = 0;
+    for (size_t i = 0; i < edges.size(); i++)
+    {
+        if (!validateTaskId(edges[i].first) || !validateTaskId(edges[i].second))
+        {
+            error = "edge " + to_string(i + 1) + " (" + to_string(edges[i].first) + " on " +
+                    to_string(edges[i].second) + "): unknown task ID";
+            return false;
+        }
+    }
+
+    size_t rows = all_tasks.size();
+    vector<size_t> offsets(rows + 1, 0);
+    for (const pair<int, int> &edge : edges)
+        offsets[edge.first]++;
+    for (size_t r = 0; r < rows; r++)
+        offsets[r + 1] += offsets[r];
+    vector<size_t> cursor(offsets.begin(), offsets.end() - 1);
+    vector<int> targets(edges.size());
+    for (const pair<int, int> &edge : edges)
+        targets[cursor[edge.first - 1]++] = edge.second - 1; // Keeps batch order within a task
+
+    // Keep the first copy of each edge, compacting in place
+    vector<int> stamp(rows, 0);
+    vector<size_t> kept(rows, 0), incoming(rows, 0);
+    size_t new_edges = 0;
+    for (size_t r = 0; r < rows; r++)
+    {
+        if (offsets[r] == offsets[r + 1])
+            continue;
+        int mark = r + 1;
+        for (const Task *dependency : all_tasks[r].getDependencies())
+            stamp[dependency->getId() - 1] = mark;
+        size_t write = offsets[r];
+        for (size_t e = offsets[r]; e < offsets[r + 1]; e++)
+        {
+            int target = targets[e];
+            if (stamp[target] == mark)
+                continue;
+            stamp[target] = mark;
+            targets[write++] = target;
+            incoming[target]++;
+        }
+        kept[r] = write - offsets[r];
+        new_edges += kept[r];
+    }
+
+    for (size_t r = 0; r < rows; r++)
+    {
+        if (kept[r] == 0 && incoming[r] == 0)
+            continue;
+        Task &task = all_tasks[r];
+        task.reserveEdges(task.getSubtasks().size(),
+                          grownCapacity(task.getDependencies().size(), kept[r]),
+                          grownCapacity(task.getDependents().size(), incoming[r]));
+    }
+
+    bool rebuild = new_edges > rows / 4;
+    for (size_t r = 0; r < rows; r++)
+    {
+        for (size_t e = offsets[r]; e < offsets[r] + kept[r]; e++)
+        {
+            int dependency_id = targets[e] + 1;
+            all_tasks[r].addDependency(&all_tasks[targets[e]]);
+            if (journal)
+                journal->logDependency(r + 1, dependency_id);
+            if (event_log)
+                event_log->log(EVENT_DEPENDENCY_ADDED, r + 1, dependency_id);
+            if (!rebuild && !dependency_order.addEdge(dependency_id, r + 1))
+                cyclic_edge_count++;
+        }
+    }
+    if (rebuild)
+        rebuildDependencyOrder();
+    if (journal)
+        compactJournalIfLarge();
+    if (added)
+        *added = new_edges;
+    return true;
+}
+
+// Post-order over dependency edges puts every dependency before its dependents;
+// the edges that still point backwards are exactly the ones closing a cycle
+void TaskManager::rebuildDependencyOrder()
+{
+    size_t rows = all_tasks.size();
+    vector<int> order;
+    order.reserve(rows);
+    vector<pair<int, int>> edges;
+    vector<char> state(rows, 0); // 0 = new, 1 = on stack, 2 = placed
+    vector<pair<size_t, size_t>> stack;
+    for (size_t start = 0; start < rows; start++)
+    {
+        if (state[start] != 0)
+            continue;
+        stack.push_back(make_pair(start, 0));
+        state[start] = 1;
+        while (!stack.empty())
+        {
+            size_t node = stack.back().first;
+            size_t &next_edge = stack.back().second;
+            const vector<Task *> &dependencies = all_tasks[node].getDependencies();
+            if (next_edge < dependencies.size())
+            {
+                size_t dep = dependencies[next_edge++]->getId() - 1;
+                edges.push_back(make_pair(dep + 1, node + 1));
+                if (state[dep] == 0)
+                {
+                    state[dep] = 1;
+                    stack.push_back(make_pair(dep, 0));
+                }
+                continue;
+            }
+            state[node] = 2;
+            order.push_back(node + 1);
+            stack.pop_back();
+        }
+    }
+    cyclic_edge_count = dependency_order.assign(order, edges);
 }
 
 #ifndef D2_MODE
-void TaskManager::setScheduler(unique_ptr<Scheduler> sched) { current_scheduler = move(sched); }
+void TaskManager::setScheduler(unique_ptr<Scheduler> sched)
+{
+    current_scheduler = move(sched);
+    scheduler_changes++;
+}
+
+void TaskManager::executeOnline(DeadlineScheduler &queue)
+{
+    last_scheduler_name = queue.getName();
+    executor.resetExecutionTime();
+    snapshots.beginRun(snapshotStructure(), task_store.getStatuses());
+    executor.runOnline(queue);
+    snapshots.endRun();
+    refreshSnapshot();
+    total_simulated_time = executor.getTotalExecutionTime();
+    completed_tasks = task_store.countStatus(COMPLETED);
+}
 #endif
 
-void TaskManager::executeAll()
+void TaskManager::setWorkerCount(int workers) { executor.setWorkerCount(workers); }
+
+void TaskManager::setExecutionDelay(int ms) { executor.setDelayPerUnit(ms); }
+
+void TaskManager::setQuietExecution(bool quiet) { executor.setQuiet(quiet); }
+
+void TaskManager::setEventLog(EventLog *log)
 {
+    if (event_log)
+        executor.removeListener(event_log);
+    event_log = log;
+    if (event_log)
+        executor.addListener(event_log);
+}
+
+SnapshotPublisher &TaskManager::getSnapshots() { return snapshots; }
+
+void TaskManager::addExecutionListener(ExecutionListener *listener) { executor.addListener(listener); }
+
+void TaskManager::removeExecutionListener(ExecutionListener *listener) { executor.removeListener(listener); }
+
+// Changes with every task, edge, priority/deadline/time edit and scheduler swap
+unsigned long long TaskManager::getGraphVersion() const { return task_store.getVersion() + scheduler_changes; }
+
+// Run the scheduler only when the graph changed since the last call
+const vector<Task *> &TaskManager::currentSchedule()
+{
+    unsigned long long version = getGraphVersion();
+    if (schedule_valid && cached_version == version)
+        return cached_schedule;
+
     vector<Task *> task_ptrs;
-    for (const auto &task_ptr : all_tasks)
-        task_ptrs.push_back(task_ptr.get());
+    task_ptrs.reserve(all_tasks.size());
+    for (Task &task : all_tasks)
+        task_ptrs.push_back(&task);
+    uint64_t started = ExecutionMetrics::now();
+#ifdef D2_MODE
+    cached_schedule = priority_scheduler->schedule(task_ptrs);
+#else
+    cached_schedule = current_scheduler->schedule(task_ptrs);
+#endif
+    metrics.record(ExecutionMetrics::SCHEDULE, ExecutionMetrics::now() - started);
+    cached_version = version;
+    schedule_valid = true;
+    return cached_schedule;
+}
+
+Task *TaskManager::peekNextTask()
+{
+    for (Task *task : currentSchedule())
+        if (task->getStatus() != COMPLETED && task->isReady())
+            return task;
+    return nullptr;
+}
+
+bool TaskManager::executeAll()
+{
+    const vector<Task *> &scheduled_tasks = currentSchedule();
 #ifdef D2_MODE
-    vector<Task *> scheduled_tasks = priority_scheduler->schedule(task_ptrs);
     last_scheduler_name = priority_scheduler->getName();
 #else
-    vector<Task *> scheduled_tasks = current_scheduler->schedule(task_ptrs);
     last_scheduler_name = current_scheduler->getName();
 #endif
     executor.resetExecutionTime();
+    snapshots.beginRun(snapshotStructure(), task_store.getStatuses());
     executor.runTasks(scheduled_tasks, last_scheduler_name);
+    snapshots.endRun();
+    refreshSnapshot();
     total_simulated_time = executor.getTotalExecutionTime();
-    completed_tasks = 0;
-    for (const auto &task_ptr : all_tasks)
-        if (task_ptr->getStatus() == COMPLETED)
-            completed_tasks++;
+    completed_tasks = task_store.countStatus(COMPLETED);
+    if (!commitJournal())
+        return false;
+    if (journal)
+        compactJournalIfLarge();
+    return true;
 }
 
-Task *TaskManager::findTaskById(int id) const
+void TaskManager::simulateAll(SimulationResult &result)
 {
-    auto it = task_map.find(id);
-    return (it != task_map.end()) ? it->second : nullptr;
+    const vector<Task *> &scheduled_tasks = currentSchedule();
+#ifdef D2_MODE
+    last_scheduler_name = priority_scheduler->getName();
+#else
+    last_scheduler_name = current_scheduler->getName();
+#endif
+    Simulator simulator(executor.getWorkerCount());
+    simulator.run(scheduled_tasks, result);
 }
 
-bool TaskManager::validateTaskId(int id) const { return task_map.find(id) != task_map.end(); }
+bool TaskManager::saveSnapshot(const string &path, uint32_t generation) const
+{
+    EdgeList subtasks, dependencies;
+    subtasks.offsets.reserve(all_tasks.size() + 1);
+    dependencies.offsets.reserve(all_tasks.size() + 1);
+    subtasks.offsets.push_back(0);
+    dependencies.offsets.push_back(0);
+    for (const Task &task : all_tasks)
+    {
+        for (const Task *subtask : task.getSubtasks())
+            subtasks.targets.push_back(subtask->getId() - 1);
+        for (const Task *dependency : task.getDependencies())
+            dependencies.targets.push_back(dependency->getId() - 1);
+        subtasks.offsets.push_back(subtasks.targets.size());
+        dependencies.offsets.push_back(dependencies.targets.size());
+    }
+    return SnapshotWriter::write(path, task_store, subtasks, dependencies, generation);
+}
 
-bool TaskManager::detectCycle(Task *start, set<int> &visited, set<int> &rec_stack) const
+// Columns are copied from the mapped file in one pass each; edges are attached with
+// exact pre-sized lists, and the topological order is rebuilt once at the end
+bool TaskManager::loadSnapshot(const string &path, string &error, uint32_t *generation)
 {
-    if (!start)
+    if (!all_tasks.empty())
+    {
+        error = "snapshots can only be loaded into an empty task manager";
         return false;
-    int id = start->getId();
-    if (rec_stack.find(id) != rec_stack.end())
-        return true;
-    if (visited.find(id) != visited.end())
+    }
+    SnapshotFile file;
+    if (!file.open(path, error))
         return false;
-    visited.insert(id);
-    rec_stack.insert(id);
-    for (const Task *dep : start->getDependencies())
-        if (detectCycle(const_cast<Task *>(dep), visited, rec_stack))
+    if (generation)
+        *generation = file.getGeneration();
+
+    size_t rows = file.getTaskCount();
+    vector<string> names;
+    names.reserve(file.getNameCount());
+    for (size_t i = 0; i < file.getNameCount(); i++)
+        names.push_back(file.getName(i));
+    task_store.loadRows(rows, file.getPriorities(), file.getDeadlines(), file.getStatuses(),
+                        file.getEstimatedTimes(), file.getNameIndices(), names);
+
+    for (size_t r = 0; r < rows; r++)
+        all_tasks.emplace_back(r + 1, &task_store, r);
+    next_task_id = rows + 1;
+    parent_counts.assign(rows, 0);
+    descendant_counts.assign(rows, 0);
+
+    const uint64_t *sub_offsets = file.getSubtaskOffsets(), *dep_offsets = file.getDependencyOffsets();
+    const int32_t *sub_targets = file.getSubtaskTargets(), *dep_targets = file.getDependencyTargets();
+    for (size_t r = 0; r < rows; r++)
+    {
+        Task &task = all_tasks[r];
+        task.reserveEdges(sub_offsets[r + 1] - sub_offsets[r], dep_offsets[r + 1] - dep_offsets[r]);
+        for (uint64_t e = sub_offsets[r]; e < sub_offsets[r + 1]; e++)
+        {
+            task.addSubtask(&all_tasks[sub_targets[e]]);
+            parent_counts[sub_targets[e]]++;
+        }
+        for (uint64_t e = dep_offsets[r]; e < dep_offsets[r + 1]; e++)
+            task.addDependency(&all_tasks[dep_targets[e]]);
+    }
+
+    rebuildDependencyOrder();
+
+    root_ids.clear();
+    for (size_t r = 0; r < rows; r++)
+        if (parent_counts[r] == 0)
+            root_ids.push_back(r + 1);
+    root_count = root_ids.size();
+    descendants_valid = false;
+    return true;
+}
+
+// ========== HIERARCHY INDEX ==========
+
+// A task stops being a root when it gets its first parent. Descendant counts are
+// updated in place when the parent is itself a root (nothing above it to update),
+// which covers trees built bottom-up; otherwise they are recomputed on next read.
+void TaskManager::recordSubtaskEdge(int parent_id, int subtask_id)
+{
+    if (parent_counts[subtask_id - 1]++ == 0)
+        root_count--;
+    if (descendants_valid && parent_counts[parent_id - 1] == 0 && parent_id != subtask_id)
+    {
+        long long added = 1 + descendant_counts[subtask_id - 1];
+        descendant_counts[parent_id - 1] += added;
+        total_descendants += added;
+    }
+    else
+        descendants_valid = false;
+}
+
+const vector<int> &TaskManager::getRootTaskIds() const
+{
+    if ((int)root_ids.size() != root_count)
+    {
+        size_t kept = 0;
+        for (int id : root_ids)
+            if (parent_counts[id - 1] == 0)
+                root_ids[kept++] = id;
+        root_ids.resize(kept);
+    }
+    return root_ids;
+}
+
+int TaskManager::getRootCount() const { return root_count; }
+
+int TaskManager::getTaskCount() const { return (int)all_tasks.size(); }
+
+long long TaskManager::getDescendantCount(int task_id) const
+{
+    if (!validateTaskId(task_id))
+        return 0;
+    refreshDescendantCounts();
+    return descendant_counts[task_id - 1];
+}
+
+// One iterative post-order pass: count(task) = sum over subtasks of 1 + count(subtask).
+// A subtask edge that closes a cycle counts the subtask once without its descendants.
+void TaskManager::refreshDescendantCounts() const
+{
+    if (descendants_valid)
+        return;
+    size_t count = all_tasks.size();
+    descendant_counts.assign(count, 0);
+    vector<char> state(count, 0); // 0 = new, 1 = on stack, 2 = counted
+    vector<pair<int, size_t>> stack; // (row, next subtask index)
+    for (size_t start = 0; start < count; start++)
+    {
+        if (state[start] != 0)
+            continue;
+        stack.push_back(make_pair((int)start, 0));
+        state[start] = 1;
+        while (!stack.empty())
+        {
+            int row = stack.back().first;
+            size_t &next = stack.back().second;
+            const vector<Task *> &subtasks = all_tasks[row].getSubtasks();
+            if (next < subtasks.size())
+            {
+                int child = subtasks[next++]->getId() - 1;
+                if (state[child] == 0)
+                {
+                    state[child] = 1;
+                    stack.push_back(make_pair(child, 0));
+                }
+                continue;
+            }
+            long long total = 0;
+            for (const Task *subtask : subtasks)
+            {
+                int child = subtask->getId() - 1;
+                total += 1 + (state[child] == 2 ? descendant_counts[child] : 0);
+            }
+            descendant_counts[row] = total;
+            state[row] = 2;
+            stack.pop_back();
+        }
+    }
+    total_descendants = 0;
+    for (long long value : descendant_counts)
+        total_descendants += value;
+    descendants_valid = true;
+}
+
+// ========== READ SNAPSHOTS ==========
+
+// Owner thread only, outside runs
+shared_ptr<const SnapshotStructure> TaskManager::snapshotStructure() const
+{
+    shared_ptr<const SnapshotStructure> structure = snapshots.getCurrentStructure();
+    if (structure && structure->graph_version == task_store.getVersion())
+        return structure;
+    refreshDescendantCounts();
+    return ReadSnapshot::buildStructure(task_store, all_tasks, task_store.getVersion(), getRootTaskIds(),
+                                        total_descendants);
+}
+
+void TaskManager::refreshSnapshot() const
+{
+    snapshots.publish(snapshotStructure(), task_store.getStatuses());
+}
+
+// ========== JOURNAL ==========
+
+// Recovery: snapshot first, then the journal records written after it.
+// A journal from an older generation is left over from a compaction that crashed
+// after the new snapshot was in place, so its records are already in the snapshot.
+bool TaskManager::openJournal(const string &path, string &error)
+{
+    if (!all_tasks.empty() || journal)
+    {
+        error = "journals can only be opened on an empty task manager";
+        return false;
+    }
+    string snapshot_path = path + ".snap";
+    uint32_t generation = 0;
+    FILE *probe = fopen(snapshot_path.c_str(), "rb");
+    if (probe != nullptr)
+    {
+        fclose(probe);
+        if (!loadSnapshot(snapshot_path, error, &generation))
+        {
+            error = snapshot_path + ": " + error;
+            return false;
+        }
+    }
+
+    // A file that is there but is not a usable journal is left alone
+    JournalReader reader;
+    string read_error;
+    bool have_journal = reader.open(path, read_error);
+    if (!have_journal && !read_error.empty())
+    {
+        error = read_error;
+        return false;
+    }
+    if (have_journal && reader.getGeneration() > generation)
+    {
+        error = "journal generation " + to_string(reader.getGeneration()) + " is newer than snapshot generation " + to_string(generation);
+        return false;
+    }
+    bool current = have_journal && reader.getGeneration() == generation;
+    if (current && !replayJournal(reader, error))
+        return false;
+
+    // Continue the journal only if every byte of it was replayed, otherwise
+    // start over from a snapshot so no damaged tail is left before new records
+    return attachJournal(path, generation, current && reader.reachedCleanEnd(), error);
+}
+
+// Files at path are replaced only when they are a journal and snapshot this
+// program can read, and the new pair gets a generation above both of them
+bool TaskManager::startJournal(const string &path, string &error)
+{
+    if (journal)
+    {
+        error = "a journal is already open";
+        return false;
+    }
+    string snapshot_path = path + ".snap";
+    uint32_t generation = 0;
+    FILE *probe = fopen(snapshot_path.c_str(), "rb");
+    if (probe != nullptr)
+    {
+        fclose(probe);
+        SnapshotFile file;
+        if (!file.open(snapshot_path, error))
+        {
+            error = snapshot_path + ": " + error;
+            return false;
+        }
+        generation = file.getGeneration();
+    }
+    JournalReader reader;
+    string read_error;
+    if (reader.open(path, read_error))
+        generation = max(generation, reader.getGeneration());
+    else if (!read_error.empty())
+    {
+        error = read_error;
+        return false;
+    }
+    return attachJournal(path, generation, false, error);
+}
+
+void TaskManager::closeJournal()
+{
+    if (!journal)
+        return;
+    journal->close();
+    executor.removeListener(journal.get());
+    journal.reset();
+    journal_replayed = 0;
+}
+
+bool TaskManager::journalExists(const string &path)
+{
+    for (const string &file : {path, path + ".snap"})
+    {
+        FILE *probe = fopen(file.c_str(), "rb");
+        if (probe != nullptr)
+        {
+            fclose(probe);
             return true;
-    rec_stack.erase(id);
+        }
+    }
     return false;
 }
 
+// Appends to the journal at path, or folds the graph into a new snapshot and
+// starts an empty journal after it
+bool TaskManager::attachJournal(const string &path, uint32_t generation, bool append, string &error)
+{
+    journal_path = path;
+    journal_generation = generation;
+    journal.reset(new Journal());
+    executor.addListener(journal.get());
+    if (append && journal->openForAppend(path))
+        return true;
+    if (!compactJournal())
+    {
+        executor.removeListener(journal.get());
+        journal.reset();
+        error = "cannot write " + path + ".snap or " + path;
+        return false;
+    }
+    return true;
+}
+
+// Replay runs before the journal is attached, so nothing is logged twice
+bool TaskManager::replayJournal(JournalReader &reader, string &error)
+{
+    JournalRecord record;
+    long count = 0;
+    while (reader.next(record))
+    {
+        count++;
+        const int *v = record.values;
+        switch (record.type)
+        {
+        case JOURNAL_CREATE:
+            createTask(record.name, v[0], v[1], v[2]);
+            continue;
+        case JOURNAL_SUBTASK:
+            if (validateTaskId(v[0]) && validateTaskId(v[1]))
+            {
+                addSubtask(v[0], v[1]);
+                continue;
+            }
+            break;
+        case JOURNAL_DEPENDENCY:
+            if (validateTaskId(v[0]) && validateTaskId(v[1]))
+            {
+                addDependency(v[0], v[1]);
+                continue;
+            }
+            break;
+        case JOURNAL_COMPLETE:
+            if (validateTaskId(v[0]))
+            {
+                all_tasks[v[0] - 1].markComplete();
+                continue;
+            }
+            break;
+        case JOURNAL_PRIORITY:
+            if (validateTaskId(v[0]))
+            {
+                task_store.setPriority(v[0] - 1, v[1]);
+                continue;
+            }
+            break;
+        }
+        error = "journal record " + to_string(count) + " refers to an unknown task";
+        return false;
+    }
+    journal_replayed = count;
+    completed_tasks = task_store.countStatus(COMPLETED);
+    return true;
+}
+
+// The snapshot is written under a temporary name and renamed into place before
+// the journal is replaced, so a crash at any point leaves a recoverable pair
+bool TaskManager::compactJournal()
+{
+    if (!journal || !journal->commit())
+        return false;
+    uint32_t generation = journal_generation + 1;
+    string snapshot_path = journal_path + ".snap", temp_path = journal_path + ".tmp";
+    if (!saveSnapshot(temp_path, generation) || !replaceFile(temp_path, snapshot_path))
+        return false;
+    journal_generation = generation;
+
+    if (!journal->create(temp_path, generation) || !journal->close())
+        return false;
+    journal_replayed = 0;
+    return replaceFile(temp_path, journal_path) && journal->openForAppend(journal_path);
+}
+
+void TaskManager::setJournalCompactThreshold(long records) { journal_compact_records = records; }
+
+void TaskManager::compactJournalIfLarge()
+{
+    if (journal_replayed + journal->getRecordCount() >= journal_compact_records)
+        compactJournal();
+}
+
+bool TaskManager::commitJournal()
+{
+    return !journal || journal->commit();
+}
+
+const string &TaskManager::getJournalError() const
+{
+    static const string none;
+    return journal ? journal->getError() : none;
+}
+
+void TaskManager::reportJournalFailure()
+{
+    if (journal_failure_shown)
+        return;
+    journal_failure_shown = true;
+    printError("Journal write failed (" + getJournalError() + "); changes are no longer being recorded.");
+}
+
+Task *TaskManager::findTaskById(int id) const
+{
+    return validateTaskId(id) ? const_cast<Task *>(&all_tasks[id - 1]) : nullptr;
+}
+
+bool TaskManager::validateTaskId(int id) const { return id >= 1 && id <= (int)all_tasks.size(); }
+
+// Every accepted edge keeps the topological order valid, so the graph has a
+// cycle exactly when some edge was rejected by the order
 bool TaskManager::hasCircularDependencies() const
 {
-    set<int> visited, rec_stack;
-    for (const auto &task_ptr : all_tasks)
-        if (detectCycle(task_ptr.get(), visited, rec_stack))
-            return true;
-    return false;
+    uint64_t started = ExecutionMetrics::now();
+    bool cyclic = cyclic_edge_count > 0;
+    metrics.record(ExecutionMetrics::CYCLE_CHECK, ExecutionMetrics::now() - started);
+    return cyclic;
+}
+
+vector<vector<int>> TaskManager::findDependencyCycles() const
+{
+    if (!hasCircularDependencies())
+        return vector<vector<int>>();
+    vector<Task *> task_ptrs;
+    task_ptrs.reserve(all_tasks.size());
+    for (const Task &task : all_tasks)
+        task_ptrs.push_back(const_cast<Task *>(&task));
+    uint64_t started = ExecutionMetrics::now();
+    vector<vector<int>> cycles = CycleFinder::findCycles(task_ptrs);
+    metrics.record(ExecutionMetrics::CYCLE_CHECK, ExecutionMetrics::now() - started);
+    return cycles;
 }
 
 // OOP Concept: Operator Overloading Demonstrations
@@ -503,6 +1291,8 @@ void TaskManager::modifyTaskPriorityDemo()
     cout << "\n    Original: " << *task << "\n    New Task: " << newTask << "\n\n[6] Using - operator (task - 2) - creates new Task:";
     Task anotherTask = *task - 2;
     cout << "\n    Original: " << *task << "\n    New Task: " << anotherTask << endl;
+    if (journal)
+        journal->logPriority(id, task->getPriority());
     printSuccess("Priority automatically clamped to [1-10]");
     cout << "+============================================+" << endl;
 }
@@ -518,8 +1308,8 @@ void TaskManager::displayTasksWithOperator()
          << COLOR_CYAN << "+============================================+\n|  OPERATOR OVERLOADING: STREAM OUTPUT (<<)  |\n"
          << "+============================================+" << COLOR_RESET << "\n\nAll tasks using << operator:\n"
          << endl;
-    for (const auto &task_ptr : all_tasks)
-        cout << "  " << *task_ptr << endl;
+    for (const Task &task : all_tasks)
+        cout << "  " << task << endl;
     cout << "\n+============================================+" << endl;
 }
 
@@ -535,13 +1325,11 @@ void TaskManager::statisticsDemo()
     cout << "\n"
          << COLOR_CYAN << "+============================================+\n|      TEMPLATE: STATISTICS CALCULATOR       |\n"
          << "+============================================+" << COLOR_RESET << endl;
-    vector<int> priorities, deadlines, times;
-    for (const auto &task_ptr : all_tasks)
-    {
-        priorities.push_back(task_ptr->getPriority());
-        deadlines.push_back(task_ptr->getDeadline());
-        times.push_back(task_ptr->getEstimatedTime());
-    }
+    // Columns are read in place from the snapshot, no per-task copies
+    refreshSnapshot();
+    SnapshotPublisher::Reader snapshot(snapshots);
+    const vector<int> &priorities = snapshot->getPriorities(), &deadlines = snapshot->getDeadlines(),
+                      &times = snapshot->getEstimatedTimes();
     cout << "\n"
          << COLOR_YELLOW << "--- Priority Statistics ---" << COLOR_RESET
          << "\n  Total Tasks: " << priorities.size() << "\n  Average Priority: " << Statistics<int>::average(priorities)
@@ -595,15 +1383,15 @@ void TaskManager::comparatorDemo()
          << COLOR_CYAN << "+============================================+\n|      TEMPLATE: GENERIC COMPARATOR          |\n"
          << "+============================================+" << COLOR_RESET << endl;
     vector<Task *> taskPtrs;
-    for (const auto &task_ptr : all_tasks)
-        taskPtrs.push_back(task_ptr.get());
+    for (Task &task : all_tasks)
+        taskPtrs.push_back(&task);
     cout << "\n"
          << COLOR_YELLOW << "--- Finding Max/Min Priority Tasks ---" << COLOR_RESET << endl;
     Task *maxTask = Comparator<Task *>::findMax(taskPtrs), *minTask = Comparator<Task *>::findMin(taskPtrs);
     cout << "  Highest Priority Task: " << *maxTask << "\n  Lowest Priority Task:  " << *minTask << endl;
-    vector<int> priorities;
-    for (const auto &task_ptr : all_tasks)
-        priorities.push_back(task_ptr->getPriority());
+    refreshSnapshot();
+    SnapshotPublisher::Reader snapshot(snapshots);
+    const vector<int> &priorities = snapshot->getPriorities();
     cout << "\n"
          << COLOR_YELLOW << "--- Sorting Priorities ---" << COLOR_RESET << "\n  Original: ";
     for (int p : priorities)
@@ -2,13 +2,18 @@
 #define TASK_MANAGER_H
 
 #include <vector>
+#include <deque>
 #include <memory>
-#include <map>
-#include <set>
 #include "config.h"
 #include "task.h"
 #include "scheduler.h"
 #include "task_executor.h"
+#include "topological_order.h"
+#include "journal.h"
+#include "event_log.h"
+#include "simulator.h"
+#include "execution_metrics.h"
+#include "snapshot_publisher.h"
 
 #ifndef D2_MODE
 #include "template_utils.h"
@@ -16,6 +21,15 @@
 
 using namespace std;
 
+// One task for bulk creation (see TaskManager::createTasks)
+struct TaskSpec
+{
+    string name;
+    int priority;
+    int deadline;
+    int time;
+};
+
 // OOP Concept: Encapsulation - TaskManager encapsulates all task management logic
 // OOP Concept: Composition - Contains collections of Task objects and a Scheduler
 
@@ -23,8 +37,8 @@ class TaskManager
 {
 private:
     // OOP Concept: Composition - TaskManager owns and manages Task objects
-    vector<unique_ptr<Task>> all_tasks; // Owns tasks (smart pointers)
-    map<int, Task *> task_map;          // Quick lookup by ID
+    TaskStore task_store;  // Task properties, one column per field
+    deque<Task> all_tasks; // Task handles, all_tasks[id - 1] (stable addresses)
 
 #ifdef D2_MODE
     // Deadline 2 Mode: Direct scheduler (no polymorphism)
@@ -37,6 +51,44 @@ private:
     TaskExecutor executor;
     int next_task_id;
 
+    // Last schedule, reused until the graph or the scheduler changes
+    vector<Task *> cached_schedule;
+    unsigned long long cached_version;
+    bool schedule_valid;
+    unsigned long long scheduler_changes;
+
+    // Dependency order maintained incrementally as edges are added
+    TopologicalOrder dependency_order;
+    int cyclic_edge_count; // Dependencies that closed a cycle
+
+    // Subtask hierarchy index, updated as subtasks are added
+    vector<int> parent_counts;        // Parents per task, by ID - 1
+    mutable vector<int> root_ids;     // Root tasks in creation order; may hold tasks that
+                                      // have gained a parent since (dropped on next read)
+    int root_count;
+    mutable vector<long long> descendant_counts; // Cached getTotalSubtasks() per task, by ID - 1
+    mutable long long total_descendants;         // Sum of descendant_counts
+    mutable bool descendants_valid;
+
+    // Write-ahead journal of mutations (null when journaling is off)
+    unique_ptr<Journal> journal;
+    string journal_path;
+    uint32_t journal_generation;
+    long journal_replayed;        // Records already in the journal file when it was opened
+    long journal_compact_records; // Compact once the journal holds this many records
+    bool journal_failure_shown;   // The menu already reported a failed journal write
+
+    // Binary event log (not owned, null when off)
+    EventLog *event_log;
+
+    // Latency histograms; mutable so const queries such as
+    // hasCircularDependencies() can time themselves
+    mutable ExecutionMetrics metrics;
+
+    // Published read-only views for the reports and for other threads;
+    // mutable so const reports can publish a fresh one first
+    mutable SnapshotPublisher snapshots;
+
     // Execution statistics
     int completed_tasks;
     int total_simulated_time;
@@ -59,9 +111,13 @@ private:
     void addSubtaskToTask();
     void setTaskDependency();
     void chooseSchedulingStrategy();
+    void chooseWorkerCount();
+    void simulateAllTasks();
     void displayTaskHierarchy() const;
     void executeAllTasks();
     void printSummaryReport() const;
+    void printSummaryReport(ostream &out, bool color) const;
+    void printSimulationReport(ostream &out, const SimulationResult &result, bool color, size_t max_rows) const;
 
     // Operator Overloading demonstration methods
     void compareTasksDemo();
@@ -75,15 +131,30 @@ private:
     void comparatorDemo();
 #endif
 
+    // Recompute the topological order and the cycle count from every dependency
+    void rebuildDependencyOrder();
+
+    // Hierarchy index helpers
+    void recordSubtaskEdge(int parent_id, int subtask_id);
+    void refreshDescendantCounts() const;
+
+    // Snapshot helpers: the structure is rebuilt only when the graph changed
+    shared_ptr<const SnapshotStructure> snapshotStructure() const;
+    void refreshSnapshot() const;
+
+    // Journal helpers
+    bool replayJournal(JournalReader &reader, string &error);
+    bool attachJournal(const string &path, uint32_t generation, bool append, string &error);
+    void compactJournalIfLarge();
+    void reportJournalFailure(); // Menu only, prints the first failure once
+
     // Validation helpers
     Task *findTaskById(int id) const;
     bool validateTaskId(int id) const;
-    bool detectCycle(Task *start, set<int> &visited, set<int> &rec_stack) const;
-    bool hasCircularDependencies() const;
 
 public:
-    // Constructor
-    TaskManager();
+    // Constructor - execution progress is written to execution_log
+    explicit TaskManager(ostream &execution_log = cout);
 
     // Main CLI loop
     // OOP Concept: Abstraction - High-level interface for user interaction
@@ -92,16 +163,96 @@ public:
     // Task creation and management
     Task *createTask(const string &name, int priority, int deadline, int time);
     void addSubtask(int parent_id, int subtask_id);
-    void addDependency(int task_id, int dependency_id);
+    bool addDependency(int task_id, int dependency_id); // false if the edge creates a cycle
+
+    // Bulk construction: containers are sized once for the whole batch.
+    // createTasks returns the ID of the first new task (IDs are consecutive).
+    // addDependencies takes (task_id, dependency_id) pairs; it rejects the whole
+    // batch if any ID is unknown, skips edges that already exist or repeat in
+    // the batch, and checks for cycles once (see hasCircularDependencies)
+    int createTasks(const vector<TaskSpec> &specs);
+    bool addDependencies(const vector<pair<int, int>> &edges, string &error, size_t *added = nullptr);
 
 #ifndef D2_MODE
     // Scheduler management (Final mode only)
     // OOP Concept: Polymorphism - Accepts any Scheduler subclass
     void setScheduler(unique_ptr<Scheduler> sched);
+
+    // Drain an online EDF queue that other threads keep feeding (tasks must
+    // already exist, see deadline_scheduler.h)
+    void executeOnline(class DeadlineScheduler &queue);
 #endif
 
+    int getTaskCount() const;
+
+    // Hierarchy queries
+    const vector<int> &getRootTaskIds() const; // Tasks that are nobody's subtask, O(roots) amortized
+    int getRootCount() const;
+    long long getDescendantCount(int task_id) const; // Same as Task::getTotalSubtasks(), cached
+
+    // Schedule queries (served from the cache while the graph is unchanged)
+    unsigned long long getGraphVersion() const;
+    const vector<Task *> &currentSchedule();
+    Task *peekNextTask(); // First pending task that is ready to run, nullptr if none
+
     // Execution
-    void executeAll();
+    // Number of worker threads, values above 1 enable parallel work-stealing execution
+    void setWorkerCount(int workers);
+    // Real milliseconds per simulated time unit (0 for batch runs)
+    void setExecutionDelay(int ms);
+    // Suppress all execution output (batch runs without a log)
+    void setQuietExecution(bool quiet);
+    // Record graph changes and task starts/completions in a binary event log
+    // (not owned, null to stop; see event_log.h)
+    void setEventLog(EventLog *log);
+    // Consistent read-only view of the graph that never blocks execution; from
+    // any thread: SnapshotPublisher::Reader view(manager.getSnapshots());
+    // During a run the view is refreshed by the workers (see snapshot_publisher.h)
+    SnapshotPublisher &getSnapshots();
+    // Observers of task start/completion (not owned, see execution_listener.h)
+    void addExecutionListener(ExecutionListener *listener);
+    void removeExecutionListener(ExecutionListener *listener);
+    bool hasCircularDependencies() const;
+    // Member task IDs of every dependency cycle (see cycle_finder.h)
+    vector<vector<int>> findDependencyCycles() const;
+    // false if the journal could not record the run (see getJournalError)
+    bool executeAll();
+
+    // Discrete-event simulation of the current schedule on the configured
+    // number of workers; no waiting and no status changes (see simulator.h)
+    void simulateAll(SimulationResult &result);
+
+    // Binary snapshot of the whole graph (see snapshot.h)
+    // loadSnapshot only works on an empty TaskManager
+    bool saveSnapshot(const string &path, uint32_t generation = 0) const;
+    bool loadSnapshot(const string &path, string &error, uint32_t *generation = nullptr);
+
+    // Crash recovery (see journal.h): restores the graph from <path>.snap plus the
+    // journal at path, then logs every later mutation and completion to it.
+    // Only works on an empty TaskManager
+    bool openJournal(const string &path, string &error);
+    // Journal the current graph from now on: it becomes <path>.snap and the
+    // journal at path starts empty, so a large graph is built without logging
+    // every record. Fails, touching nothing, if path holds some other file
+    bool startJournal(const string &path, string &error);
+    // Write what is buffered and stop journaling
+    void closeJournal();
+    // True if path or <path>.snap exists
+    static bool journalExists(const string &path);
+    // Fold the journal into a fresh snapshot and start an empty journal
+    bool compactJournal();
+    void setJournalCompactThreshold(long records);
+    // Write and fsync every logged mutation; true when journaling is off
+    bool commitJournal();
+    const string &getJournalError() const;
+
+    // Plain-text summary report (used by batch mode)
+    void writeSummaryReport(ostream &out) const;
+    // Latency histograms in the Prometheus text format (see execution_metrics.h)
+    void writeMetrics(ostream &out) const;
+    bool exportMetrics(const string &path) const;
+    // Simulation summary followed by every task's virtual start/finish time
+    void writeSimulationReport(ostream &out, const SimulationResult &result) const;
 };
 
 #endif // TASK_MANAGER_H
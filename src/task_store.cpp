@@ -0,0 +1,175 @@
+#include "task_store.h"
+
+using namespace std;
+
+// Constructor
+TaskStore::TaskStore() : version(0)
+{
+}
+
+// Return the index of a name, adding it to the pool if new
+int TaskStore::internName(const string &name)
+{
+    auto it = name_lookup.find(name);
+    if (it != name_lookup.end())
+        return it->second;
+    int index = names.size();
+    names.push_back(name);
+    name_lookup[name] = index;
+    return index;
+}
+
+// Append a new task row to every column
+int TaskStore::addRow(const string &name, int priority, int deadline, int time)
+{
+    int row = priorities.size();
+    priorities.push_back(priority);
+    deadlines.push_back(deadline);
+    statuses.push_back(PENDING);
+    estimated_times.push_back(time);
+    name_indices.push_back(internName(name));
+    version++;
+    return row;
+}
+
+void TaskStore::reserve(size_t rows)
+{
+    priorities.reserve(rows);
+    deadlines.reserve(rows);
+    statuses.reserve(rows);
+    estimated_times.reserve(rows);
+    name_indices.reserve(rows);
+}
+
+void TaskStore::loadRows(size_t rows, const int32_t *priority_data, const int32_t *deadline_data,
+                         const int32_t *status_data, const int32_t *time_data, const int32_t *name_index_data,
+                         const vector<string> &name_pool)
+{
+    priorities.assign(priority_data, priority_data + rows);
+    deadlines.assign(deadline_data, deadline_data + rows);
+    estimated_times.assign(time_data, time_data + rows);
+    name_indices.assign(name_index_data, name_index_data + rows);
+    statuses.resize(rows);
+    for (size_t r = 0; r < rows; r++)
+        statuses[r] = static_cast<TaskStatus>(status_data[r]);
+
+    names = name_pool;
+    name_lookup.clear();
+    for (size_t i = 0; i < names.size(); i++)
+        name_lookup.emplace(names[i], i);
+    version++;
+}
+
+size_t TaskStore::size() const
+{
+    return priorities.size();
+}
+
+// Single-row getters
+const string &TaskStore::getName(int row) const
+{
+    return names[name_indices[row]];
+}
+
+int TaskStore::getPriority(int row) const
+{
+    return priorities[row];
+}
+
+int TaskStore::getDeadline(int row) const
+{
+    return deadlines[row];
+}
+
+TaskStatus TaskStore::getStatus(int row) const
+{
+    return statuses[row];
+}
+
+int TaskStore::getEstimatedTime(int row) const
+{
+    return estimated_times[row];
+}
+
+// Single-row setters
+void TaskStore::setName(int row, const string &name)
+{
+    name_indices[row] = internName(name);
+    version++;
+}
+
+void TaskStore::setPriority(int row, int priority)
+{
+    priorities[row] = priority;
+    version++;
+}
+
+void TaskStore::setDeadline(int row, int deadline)
+{
+    deadlines[row] = deadline;
+    version++;
+}
+
+void TaskStore::setStatus(int row, TaskStatus status)
+{
+    statuses[row] = status;
+}
+
+void TaskStore::setEstimatedTime(int row, int time)
+{
+    estimated_times[row] = time;
+    version++;
+}
+
+// Column getters
+const vector<int> &TaskStore::getPriorities() const
+{
+    return priorities;
+}
+
+const vector<int> &TaskStore::getDeadlines() const
+{
+    return deadlines;
+}
+
+const vector<TaskStatus> &TaskStore::getStatuses() const
+{
+    return statuses;
+}
+
+const vector<int> &TaskStore::getEstimatedTimes() const
+{
+    return estimated_times;
+}
+
+const vector<int> &TaskStore::getNameIndices() const
+{
+    return name_indices;
+}
+
+unsigned long long TaskStore::getVersion() const
+{
+    return version;
+}
+
+void TaskStore::bumpVersion()
+{
+    version++;
+}
+
+const vector<string> &TaskStore::getNamePool() const
+{
+    return names;
+}
+
+// Linear scan over the status column
+int TaskStore::countStatus(TaskStatus status) const
+{
+    int count = 0;
+    for (TaskStatus s : statuses)
+    {
+        if (s == status)
+            count++;
+    }
+    return count;
+}
@@ -0,0 +1,89 @@
+#ifndef TASK_STORE_H
+#define TASK_STORE_H
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+using namespace std;
+
+// Task status values (stored as one column of the TaskStore)
+enum TaskStatus
+{
+    PENDING,
+    RUNNING,
+    COMPLETED
+};
+
+// OOP Concept: Encapsulation - Column-oriented storage of task properties
+// Each property lives in its own contiguous array, indexed by row.
+// TaskManager uses row = task ID - 1, so lookups by ID are direct indexing and
+// scheduling/statistics passes are linear scans over one array.
+// Task objects are lightweight handles that read and write these columns.
+
+class TaskStore
+{
+private:
+    vector<int> priorities;       // 1-10, 10 is highest
+    vector<int> deadlines;        // Integer days from now
+    vector<TaskStatus> statuses;
+    vector<int> estimated_times;  // Simulated execution time units
+    vector<int> name_indices;     // Index into names
+
+    // Interned task names (repeated names are stored once)
+    vector<string> names;
+    unordered_map<string, int> name_lookup;
+
+    // Bumped by every change that can affect a schedule (new rows, names,
+    // priorities, deadlines, times and edges); status changes do not count
+    unsigned long long version;
+
+    int internName(const string &name);
+
+public:
+    TaskStore();
+
+    // Append a row, returns its index
+    int addRow(const string &name, int priority, int deadline, int time);
+
+    // Pre-size all columns for a known number of tasks
+    void reserve(size_t rows);
+
+    // Replace the whole table with bulk column data (one copy per column)
+    void loadRows(size_t rows, const int32_t *priority_data, const int32_t *deadline_data,
+                  const int32_t *status_data, const int32_t *time_data, const int32_t *name_index_data,
+                  const vector<string> &name_pool);
+
+    size_t size() const;
+
+    // Single-row access
+    const string &getName(int row) const;
+    int getPriority(int row) const;
+    int getDeadline(int row) const;
+    TaskStatus getStatus(int row) const;
+    int getEstimatedTime(int row) const;
+
+    void setName(int row, const string &name);
+    void setPriority(int row, int priority);
+    void setDeadline(int row, int deadline);
+    void setStatus(int row, TaskStatus status);
+    void setEstimatedTime(int row, int time);
+
+    // Whole-column access for scans
+    const vector<int> &getPriorities() const;
+    const vector<int> &getDeadlines() const;
+    const vector<TaskStatus> &getStatuses() const;
+    const vector<int> &getEstimatedTimes() const;
+    const vector<int> &getNameIndices() const;
+    const vector<string> &getNamePool() const;
+
+    // Graph mutation counter, used to invalidate cached schedules
+    unsigned long long getVersion() const;
+    void bumpVersion();
+
+    // Number of rows with the given status
+    int countStatus(TaskStatus status) const;
+};
+
+#endif // TASK_STORE_H
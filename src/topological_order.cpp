@@ -0,0 +1,193 @@
+#include "topological_order.h"
+#include <algorithm>
+
+using namespace std;
+
+// Constructor
+TopologicalOrder::TopologicalOrder() : node_count(0)
+{
+}
+
+void TopologicalOrder::reserve(int nodes)
+{
+    position.reserve(nodes);
+    successors.reserve(nodes);
+    predecessors.reserve(nodes);
+    marked.reserve(nodes);
+}
+
+// Register a node at the end of the order
+void TopologicalOrder::addNode(int node)
+{
+    if (node < 0)
+        return;
+    if (node >= (int)position.size())
+    {
+        position.resize(node + 1, -1);
+        successors.resize(node + 1);
+        predecessors.resize(node + 1);
+        marked.resize(node + 1, 0);
+    }
+    if (position[node] == -1)
+        position[node] = node_count++;
+}
+
+int TopologicalOrder::assign(const vector<int> &order, const vector<pair<int, int>> &edges)
+{
+    int size = 0;
+    for (int node : order)
+        size = max(size, node + 1);
+    position.assign(size, -1);
+    successors.assign(size, vector<int>());
+    predecessors.assign(size, vector<int>());
+    marked.assign(size, 0);
+    node_count = 0;
+    for (int node : order)
+        if (node >= 0 && position[node] == -1)
+            position[node] = node_count++;
+
+    vector<int> out_degree(size, 0), in_degree(size, 0);
+    int rejected = 0;
+    for (const pair<int, int> &edge : edges)
+    {
+        if (position[edge.first] < position[edge.second])
+        {
+            out_degree[edge.first]++;
+            in_degree[edge.second]++;
+        }
+        else
+            rejected++;
+    }
+    for (int node = 0; node < size; node++)
+    {
+        successors[node].reserve(out_degree[node]);
+        predecessors[node].reserve(in_degree[node]);
+    }
+    for (const pair<int, int> &edge : edges)
+    {
+        if (position[edge.first] < position[edge.second])
+        {
+            successors[edge.first].push_back(edge.second);
+            predecessors[edge.second].push_back(edge.first);
+        }
+    }
+    return rejected;
+}
+
+// Insert an edge, repairing the order only inside the affected region
+bool TopologicalOrder::addEdge(int from, int to)
+{
+    if (from == to)
+        return false;
+    addNode(from);
+    addNode(to);
+
+    int lower = position[to], upper = position[from];
+    if (lower < upper)
+    {
+        // Order is violated: find everything between the endpoints that must move
+        if (!searchForward(to, upper))
+        {
+            clearMarks();
+            return false;
+        }
+        searchBackward(from, lower);
+        reorder();
+    }
+
+    successors[from].push_back(to);
+    predecessors[to].push_back(from);
+    return true;
+}
+
+// Visit nodes reachable from start that sit before upper_bound in the order
+// Returns false if the search reaches the node at upper_bound (a cycle)
+bool TopologicalOrder::searchForward(int start, int upper_bound)
+{
+    vector<int> stack(1, start);
+    marked[start] = 1;
+    forward_region.push_back(start);
+    while (!stack.empty())
+    {
+        int node = stack.back();
+        stack.pop_back();
+        for (int next : successors[node])
+        {
+            if (position[next] == upper_bound)
+                return false;
+            if (!marked[next] && position[next] < upper_bound)
+            {
+                marked[next] = 1;
+                forward_region.push_back(next);
+                stack.push_back(next);
+            }
+        }
+    }
+    return true;
+}
+
+// Visit nodes that reach start and sit after lower_bound in the order
+void TopologicalOrder::searchBackward(int start, int lower_bound)
+{
+    vector<int> stack(1, start);
+    marked[start] = 1;
+    backward_region.push_back(start);
+    while (!stack.empty())
+    {
+        int node = stack.back();
+        stack.pop_back();
+        for (int prev : predecessors[node])
+        {
+            if (!marked[prev] && position[prev] > lower_bound)
+            {
+                marked[prev] = 1;
+                backward_region.push_back(prev);
+                stack.push_back(prev);
+            }
+        }
+    }
+}
+
+// Functor: order nodes by their current position
+struct PositionLess
+{
+    const vector<int> &position;
+    explicit PositionLess(const vector<int> &pos) : position(pos) {}
+    bool operator()(int a, int b) const { return position[a] < position[b]; }
+};
+
+// Give the backward region the lowest freed positions, then the forward region
+void TopologicalOrder::reorder()
+{
+    sort(forward_region.begin(), forward_region.end(), PositionLess(position));
+    sort(backward_region.begin(), backward_region.end(), PositionLess(position));
+
+    vector<int> nodes = backward_region;
+    nodes.insert(nodes.end(), forward_region.begin(), forward_region.end());
+
+    vector<int> slots;
+    for (int node : nodes)
+        slots.push_back(position[node]);
+    sort(slots.begin(), slots.end());
+
+    for (size_t i = 0; i < nodes.size(); i++)
+        position[nodes[i]] = slots[i];
+
+    clearMarks();
+}
+
+// Reset scratch state touched by the last searches
+void TopologicalOrder::clearMarks()
+{
+    for (int node : forward_region)
+        marked[node] = 0;
+    for (int node : backward_region)
+        marked[node] = 0;
+    forward_region.clear();
+    backward_region.clear();
+}
+
+int TopologicalOrder::getPosition(int node) const
+{
+    return (node >= 0 && node < (int)position.size()) ? position[node] : -1;
+}
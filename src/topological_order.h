@@ -0,0 +1,53 @@
+#ifndef TOPOLOGICAL_ORDER_H
+#define TOPOLOGICAL_ORDER_H
+
+#include <vector>
+#include <utility>
+
+using namespace std;
+
+// OOP Concept: Encapsulation - Maintains a topological order of the dependency graph
+// while edges are added one at a time (Pearce-Kelly dynamic topological sort).
+// An edge that would close a cycle is rejected, so the stored order is always valid.
+// Only the region between the two endpoints is searched and reordered, which keeps
+// edge insertion close to constant time for typical graphs.
+
+class TopologicalOrder
+{
+private:
+    vector<int> position;             // Node ID -> index in the topological order
+    vector<vector<int>> successors;   // Edges in the order they must run
+    vector<vector<int>> predecessors; // Reverse edges
+    vector<char> marked;              // Scratch marks for the bounded searches
+    vector<int> forward_region, backward_region;
+    int node_count;
+
+    bool searchForward(int start, int upper_bound);
+    void searchBackward(int start, int lower_bound);
+    void reorder();
+    void clearMarks();
+
+public:
+    TopologicalOrder();
+
+    // Pre-size for node IDs below nodes (bulk construction)
+    void reserve(int nodes);
+
+    // Register a node; new nodes go to the end of the order
+    void addNode(int node);
+
+    // Add edge from -> to ("from" must run first), returns false if it would create a cycle
+    bool addEdge(int from, int to);
+
+    // Replace the whole order in one pass (bulk construction): nodes are placed
+    // in the given order, then every edge that agrees with it is added with the
+    // edge lists sized up front. Returns the number of edges rejected because
+    // they point backwards, which is zero exactly when order is a valid
+    // topological order of the edges.
+    int assign(const vector<int> &order, const vector<pair<int, int>> &edges);
+
+    // Index of a node in the current order (-1 if unknown)
+    int getPosition(int node) const;
+};
+
+#endif // TOPOLOGICAL_ORDER_H
@@ -0,0 +1,139 @@
+#include "trace_recorder.h"
+#include "task.h"
+#include "execution_metrics.h"
+#include <fstream>
+#include <cstdio>
+
+using namespace std;
+
+// Append text escaped for use inside a JSON string literal
+static void appendJsonEscaped(string &buffer, const string &text)
+{
+    for (char c : text)
+    {
+        if (c == '"' || c == '\\')
+        {
+            buffer += '\\';
+            buffer += c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20)
+        {
+            char escaped[8];
+            snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            buffer += escaped;
+        }
+        else
+            buffer += c;
+    }
+}
+
+// Constructor
+TraceRecorder::TraceRecorder() : origin_ns(0)
+{
+}
+
+// Buffers only grow here, before the run's workers start
+void TraceRecorder::onRunStarted(const string &scheduler_name, int workers)
+{
+    if (run_schedulers.empty())
+        origin_ns = ExecutionMetrics::now();
+    run_schedulers.push_back(scheduler_name);
+    if ((int)buffers.size() < workers)
+        buffers.resize(workers);
+}
+
+void TraceRecorder::onTaskStarted(Task *task, int worker_id) { record(task, worker_id, true); }
+
+void TraceRecorder::onTaskCompleted(Task *task, int worker_id) { record(task, worker_id, false); }
+
+void TraceRecorder::record(const Task *task, int worker_id, bool start)
+{
+    if (worker_id < 0 || worker_id >= (int)buffers.size())
+        return;
+    WorkerBuffer &buffer = buffers[worker_id];
+    if (!start)
+        buffer.depth--;
+    TraceEvent event;
+    event.task = task;
+    event.time_ns = ExecutionMetrics::now();
+    event.depth = buffer.depth;
+    event.run = run_schedulers.size() - 1;
+    event.start = start;
+    buffer.events.push_back(event);
+    if (start)
+        buffer.depth++;
+}
+
+size_t TraceRecorder::getEventCount() const
+{
+    size_t count = 0;
+    for (const WorkerBuffer &buffer : buffers)
+        count += buffer.events.size();
+    return count;
+}
+
+void TraceRecorder::clear()
+{
+    buffers.clear();
+    run_schedulers.clear();
+    origin_ns = 0;
+}
+
+// Begin/end ("B"/"E") pairs per worker track; timestamps are microseconds.
+// Events are formatted into a local buffer that is written out in large blocks.
+void TraceRecorder::writeJson(ostream &out) const
+{
+    const size_t FLUSH_SIZE = 1 << 20;
+    string buffer;
+    buffer.reserve(FLUSH_SIZE + 4096);
+    char field[128];
+
+    buffer += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    buffer += "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"HTSE\"}}";
+    for (size_t w = 0; w < buffers.size(); w++)
+    {
+        snprintf(field, sizeof(field), ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,", (int)w);
+        buffer += field;
+        snprintf(field, sizeof(field), "\"args\":{\"name\":\"Worker %d\"}}", (int)w);
+        buffer += field;
+    }
+
+    for (size_t w = 0; w < buffers.size(); w++)
+    {
+        for (const TraceEvent &event : buffers[w].events)
+        {
+            const Task *task = event.task;
+            snprintf(field, sizeof(field), ",\n{\"name\":\"Task%d - ", task->getId());
+            buffer += field;
+            appendJsonEscaped(buffer, task->getName());
+            snprintf(field, sizeof(field), "\",\"cat\":\"task\",\"ph\":\"%c\",\"pid\":1,\"tid\":%d,\"ts\":%.3f",
+                     event.start ? 'B' : 'E', (int)w, (event.time_ns - origin_ns) / 1e3);
+            buffer += field;
+            if (event.start)
+            {
+                snprintf(field, sizeof(field), ",\"args\":{\"id\":%d,\"depth\":%d,\"priority\":%d,\"scheduler\":\"",
+                         task->getId(), event.depth, task->getPriority());
+                buffer += field;
+                appendJsonEscaped(buffer, run_schedulers[event.run]);
+                buffer += "\"}";
+            }
+            buffer += '}';
+            if (buffer.size() >= FLUSH_SIZE)
+            {
+                out.write(buffer.data(), buffer.size());
+                buffer.clear();
+            }
+        }
+    }
+    buffer += "\n]}\n";
+    out.write(buffer.data(), buffer.size());
+}
+
+bool TraceRecorder::writeFile(const string &path) const
+{
+    ofstream file(path);
+    if (!file)
+        return false;
+    writeJson(file);
+    return file.good();
+}
@@ -0,0 +1,61 @@
+#ifndef TRACE_RECORDER_H
+#define TRACE_RECORDER_H
+
+#include <vector>
+#include <string>
+#include <ostream>
+#include <cstdint>
+#include "execution_listener.h"
+
+using namespace std;
+
+// OOP Concept: Inheritance - An ExecutionListener that records a timeline
+// Every task start and finish is stored with its worker, its nesting level
+// (subtasks run inside their parent in sequential mode) and the scheduler of
+// the run, then written as Chrome trace-event JSON for chrome://tracing or
+// Perfetto. Each worker appends to its own buffer, so recording takes no lock
+// and costs one clock read and one push_back per event.
+// Tasks are referenced, not copied: they must outlive writeJson().
+
+class TraceRecorder : public ExecutionListener
+{
+private:
+    struct TraceEvent
+    {
+        const Task *task;
+        uint64_t time_ns;
+        int depth;   // 0 = top-level task
+        int run;     // Index into run_schedulers
+        bool start;
+    };
+
+    // One per worker, written only by that worker's thread
+    struct alignas(64) WorkerBuffer
+    {
+        vector<TraceEvent> events;
+        int depth; // Tasks currently open on this worker
+        WorkerBuffer() : depth(0) {}
+    };
+
+    vector<WorkerBuffer> buffers;
+    vector<string> run_schedulers;
+    uint64_t origin_ns; // Time of the first run, trace timestamps start here
+
+    void record(const Task *task, int worker_id, bool start);
+
+public:
+    TraceRecorder();
+
+    void onRunStarted(const string &scheduler_name, int workers) override;
+    void onTaskStarted(Task *task, int worker_id) override;
+    void onTaskCompleted(Task *task, int worker_id) override;
+
+    size_t getEventCount() const;
+    void clear();
+
+    // {"traceEvents": [...]} with one track per worker
+    void writeJson(ostream &out) const;
+    bool writeFile(const string &path) const;
+};
+
+#endif // TRACE_RECORDER_H
@@ -0,0 +1,38 @@
+#include "work_stealing_queue.h"
+
+using namespace std;
+
+// Add a ready task to the back of this worker's queue
+void WorkStealingQueue::push(Task *task)
+{
+    lock_guard<mutex> guard(lock);
+    tasks.push_back(task);
+}
+
+// Owner takes the oldest (highest scheduled) task
+bool WorkStealingQueue::pop(Task *&task)
+{
+    lock_guard<mutex> guard(lock);
+    if (tasks.empty())
+        return false;
+    task = tasks.front();
+    tasks.pop_front();
+    return true;
+}
+
+// Thief takes the newest task so it rarely contends with the owner
+bool WorkStealingQueue::steal(Task *&task)
+{
+    lock_guard<mutex> guard(lock);
+    if (tasks.empty())
+        return false;
+    task = tasks.back();
+    tasks.pop_back();
+    return true;
+}
+
+bool WorkStealingQueue::isEmpty() const
+{
+    lock_guard<mutex> guard(lock);
+    return tasks.empty();
+}
@@ -0,0 +1,30 @@
+#ifndef WORK_STEALING_QUEUE_H
+#define WORK_STEALING_QUEUE_H
+
+#include <deque>
+#include <mutex>
+#include "task.h"
+
+using namespace std;
+
+// OOP Concept: Encapsulation - Each worker owns one queue; other workers may steal from it
+// The owner takes work from the front (keeps scheduler order), thieves take from the back
+
+class WorkStealingQueue
+{
+private:
+    deque<Task *> tasks;
+    mutable mutex lock;
+
+public:
+    // Owner operations
+    void push(Task *task);
+    bool pop(Task *&task);
+
+    // Called by other workers when their own queue is empty
+    bool steal(Task *&task);
+
+    bool isEmpty() const;
+};
+
+#endif // WORK_STEALING_QUEUE_H
@@ -0,0 +1,62 @@
+// HTSE event log decoder
+//
+// Prints a binary event log written with --events as one line per record:
+//   <time since first record in us> <worker> <type> #<task> <value>
+//
+// Build (from the repository root, needs only the header):
+//   g++ -std=c++17 -Isrc tools/event_decode.cpp -o event_decode
+
+#include "event_log.h"
+#include <cstdio>
+#include <cstring>
+#include <cinttypes>
+
+int main(int argc, char *argv[])
+{
+    if (argc != 2)
+    {
+        fprintf(stderr, "Usage: %s <events file>\n", argv[0]);
+        return 2;
+    }
+    FILE *file = fopen(argv[1], "rb");
+    if (file == nullptr)
+    {
+        fprintf(stderr, "Cannot open %s\n", argv[1]);
+        return 1;
+    }
+
+    char magic[8];
+    uint32_t header[2];
+    if (fread(magic, 1, 8, file) != 8 || memcmp(magic, EVENT_LOG_MAGIC, 8) != 0 ||
+        fread(header, sizeof(header), 1, file) != 1)
+    {
+        fprintf(stderr, "%s is not an event log\n", argv[1]);
+        fclose(file);
+        return 1;
+    }
+    if (header[0] != EVENT_LOG_VERSION || header[1] != sizeof(EventRecord))
+    {
+        fprintf(stderr, "Unsupported event log version %u (record size %u)\n", header[0], header[1]);
+        fclose(file);
+        return 1;
+    }
+
+    EventRecord batch[4096];
+    uint64_t first_time = 0, count = 0;
+    size_t read;
+    while ((read = fread(batch, sizeof(EventRecord), 4096, file)) > 0)
+    {
+        for (size_t i = 0; i < read; i++)
+        {
+            const EventRecord &record = batch[i];
+            if (count++ == 0)
+                first_time = record.time_ns;
+            double offset_us = (double)(int64_t)(record.time_ns - first_time) / 1000.0;
+            printf("%12.3f %3u %-16s #%-8d %" PRId64 "\n", offset_us, (unsigned)record.worker,
+                   eventTypeName(record.type), record.task_id, record.value);
+        }
+    }
+    fclose(file);
+    fprintf(stderr, "%" PRIu64 " records\n", count);
+    return 0;
+}